@@ -0,0 +1,81 @@
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cosy/LiteralAdapter.h>
+#include <cosy/SymmetryController.h>
+
+// Memory used by the controllers of a portfolio of num_threads solvers,
+// when each one owns its symmetry data and when they share it, see
+// SymmetryController::sharedData(). Each measure is done in its own
+// process so that freed memory is not reused by the next one.
+
+typedef cosy::SymmetryController<cosy::Literal> Controller;
+
+static int64 residentKB() {
+    std::ifstream statm("/proc/self/statm");
+    int64 size, resident;
+
+    statm >> size >> resident;
+    return resident * (sysconf(_SC_PAGESIZE) / 1024);
+}
+
+static void measure(const std::string& cnf_filename,
+                    unsigned int num_threads, bool share) {
+    std::unique_ptr<cosy::LiteralAdapter<cosy::Literal>> adapter
+        (new cosy::LiteralAdapter<cosy::Literal>());
+    std::vector<std::unique_ptr<Controller>> controllers;
+    std::shared_ptr<const cosy::SymmetryData> data;
+    cosy::CosyOptions options;
+    const int64 before = residentKB();
+
+    for (unsigned int i = 0; i < num_threads; i++) {
+        if (data)
+            controllers.emplace_back(new Controller(data, adapter));
+        else
+            controllers.emplace_back(new Controller(cnf_filename,
+                                     cosy::SymmetryFinder::BLISS, adapter));
+        controllers.back()->enableCosy(options);
+        if (share && !data)
+            data = controllers.back()->sharedData();
+    }
+
+    std::cout << (residentKB() - before) << (share ? "\n" : "  ");
+}
+
+int main(int argc, char **argv) {
+    std::string cnf_filename;
+    unsigned int max_threads = 8;
+
+    if (argc != 2 && argc != 3) {
+        std::cerr << "Usage: cnf_file [max_threads]" << std::endl;
+        return 1;
+    }
+
+    cnf_filename = argv[1];
+    if (argc == 3)
+        max_threads = std::atoi(argv[2]);
+
+    std::cout << "threads  owned (KB)  shared (KB)" << std::endl;
+    for (unsigned int num_threads = 1; num_threads <= max_threads;
+         num_threads *= 2) {
+        std::cout << num_threads << "  " << std::flush;
+        for (const bool share : { false, true }) {
+            const pid_t pid = fork();
+            if (pid == 0) {
+                measure(cnf_filename, num_threads, share);
+                std::cout << std::flush;
+                _exit(0);
+            }
+            waitpid(pid, nullptr, 0);
+        }
+    }
+
+    return 0;
+}
@@ -0,0 +1,43 @@
+#include <iostream>
+#include <string>
+
+#include <cosy/BlissSymmetryFinder.h>
+#include <cosy/CNFModel.h>
+#include <cosy/CNFReader.h>
+#include <cosy/Group.h>
+#include <cosy/Snapshot.h>
+
+int main(int argc, char **argv) {
+    std::unique_ptr<cosy::SymmetryFinder> symmetry_finder = nullptr;
+    cosy::CNFReader cnf_reader;
+    cosy::CNFModel cnf_model;
+    cosy::Group group;
+    cosy::SnapshotWriter writer;
+    std::string cnf_filename;
+    std::string snapshot_filename;
+    bool success;
+
+    if (argc != 3) {
+        std::cerr << "Usage: cnf_file snapshot_file" << std::endl;
+        return 1;
+    }
+
+    cnf_filename = argv[1];
+    snapshot_filename = argv[2];
+    success = cnf_reader.load(cnf_filename, &cnf_model);
+    if (!success) {
+        std::cerr << "CNF file " << cnf_filename << " is not well formed." <<
+            std::endl;
+        return 1;
+    }
+
+    symmetry_finder = std::unique_ptr<cosy::BlissSymmetryFinder>
+        (new cosy::BlissSymmetryFinder(cnf_model));
+    symmetry_finder->findAutomorphism(&group);
+
+    cnf_model.summarize();
+    group.summarize(cnf_model.numberOfVariables());
+
+    success = writer.write(snapshot_filename, cnf_model, group);
+    return success ? 0 : 1;
+}
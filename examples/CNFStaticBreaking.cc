@@ -0,0 +1,60 @@
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include <cosy/BlissSymmetryFinder.h>
+#include <cosy/CNFModel.h>
+#include <cosy/CNFReader.h>
+#include <cosy/Group.h>
+#include <cosy/OrderFactory.h>
+#include <cosy/StaticBreaker.h>
+
+int main(int argc, char **argv) {
+    std::unique_ptr<cosy::SymmetryFinder> symmetry_finder = nullptr;
+    std::unique_ptr<cosy::Order> order = nullptr;
+    cosy::CNFReader cnf_reader;
+    cosy::CNFModel cnf_model;
+    cosy::Group group;
+    std::string cnf_filename;
+    std::string output_filename;
+    unsigned int max_length = 0;
+    bool success;
+
+    if (argc != 3 && argc != 4) {
+        std::cerr << "Usage: cnf_file output_cnf_file [max_length]" <<
+            std::endl;
+        return 1;
+    }
+
+    cnf_filename = argv[1];
+    output_filename = argv[2];
+    if (argc == 4)
+        max_length = std::atoi(argv[3]);
+
+    success = cnf_reader.load(cnf_filename, &cnf_model);
+    if (!success) {
+        std::cerr << "CNF file " << cnf_filename << " is not well formed." <<
+            std::endl;
+        return 1;
+    }
+
+    symmetry_finder = std::unique_ptr<cosy::BlissSymmetryFinder>
+        (new cosy::BlissSymmetryFinder(cnf_model));
+    symmetry_finder->findAutomorphism(&group);
+
+    order = std::unique_ptr<cosy::Order>
+        (cosy::OrderFactory::create(cosy::BREAKID, cosy::FALSE_LESS_TRUE,
+                                    cnf_model, group));
+
+    cosy::StaticBreaker breaker(group, *order, cnf_model.numberOfVariables());
+    breaker.setMaxLength(max_length);
+    breaker.generate();
+
+    cnf_model.summarize();
+    group.summarize(cnf_model.numberOfVariables());
+    breaker.summarize();
+
+    success = breaker.write(output_filename, cnf_model);
+    return success ? 0 : 1;
+}
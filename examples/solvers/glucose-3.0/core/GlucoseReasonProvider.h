@@ -0,0 +1,25 @@
+#ifndef GlucoseReasonProvider_h
+#define GlucoseReasonProvider_h
+
+#include "cosy/ReasonProvider.h"
+#include "core/Solver.h"
+
+namespace Glucose {
+
+class GlucoseReasonProvider : public cosy::ReasonProvider<Glucose::Lit>
+{
+ public:
+        explicit GlucoseReasonProvider(const Solver& solver) : _solver(solver) {}
+        ~GlucoseReasonProvider() {}
+
+        virtual bool reason(Glucose::Lit p, std::vector<Glucose::Lit> *reason) {
+            return _solver.symmetryReason(p, reason);
+        }
+
+ private:
+        const Solver& _solver;
+};
+
+}
+
+#endif
@@ -39,6 +39,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include "core/Solver.h"
 
 #include "core/GlucoseLiteralAdapter.h"
+#include "core/GlucoseReasonProvider.h"
 #include "cosy/SymmetryController.h"
 
 using namespace Glucose;
@@ -109,11 +110,16 @@ int main(int argc, char** argv)
         IntOption    vv  ("MAIN", "vv",   "Verbosity every vv conflicts", 10000, IntRange(1,INT32_MAX));
         IntOption    cpu_lim("MAIN", "cpu-lim","Limit on CPU time allowed in seconds.\n", INT32_MAX, IntRange(0, INT32_MAX));
         IntOption    mem_lim("MAIN", "mem-lim","Limit on memory usage in megabytes.\n", INT32_MAX, IntRange(0, INT32_MAX));
+        StringOption cosy_opt("MAIN", "cosy", "Symmetry options, e.g. order=dynamic,esbp_forcing=1 (see cosy/CosyOptions.h).", "");
 
 
         parseOptions(argc, argv, true);
 
         Solver S;
+        if (cosy_opt && !S.cosy_options.parse(std::string(cosy_opt))) {
+            fprintf(stderr, "ERROR! bad -cosy option: %s\n", (const char*)cosy_opt);
+            exit(1);
+        }
         double initial_time = cpuTime();
 
         S.verbosity = verb;
@@ -193,13 +199,13 @@ int main(int argc, char** argv)
         std::unique_ptr<cosy::LiteralAdapter<Glucose::Lit>> adapter
             (new GlucoseLiteralAdapter());
 
-        std::string cnf_file = std::string(argv[1]);
-
+        // The symmetries are computed on the clauses already parsed
         S.symmetry = std::unique_ptr<cosy::SymmetryController<Glucose::Lit>>
-            (new cosy::SymmetryController<Glucose::Lit>
-             (cnf_file,
-              cosy::SymmetryFinder::Automorphism::BLISS,
-              adapter));
+            (new cosy::SymmetryController<Glucose::Lit>(S.nVars(), adapter));
+        S.addClausesTo(*S.symmetry);
+        S.symmetry->findSymmetries(S.cosy_options.finder);
+        GlucoseReasonProvider reasons(S);
+        S.symmetry->setReasonProvider(&reasons);
 
 
         vec<Lit> dummy;
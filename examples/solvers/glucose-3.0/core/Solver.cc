@@ -28,6 +28,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 **************************************************************************************************/
 
 #include <math.h>
+#include <string.h>
 
 #include "mtl/Sort.h"
 #include "core/Solver.h"
@@ -136,6 +137,14 @@ Solver::Solver() :
   , conflict_budget    (-1)
   , propagation_budget (-1)
   , asynch_interrupt   (false)
+  , terminate_state    (NULL)
+  , terminate_callback (NULL)
+  , learn_state        (NULL)
+  , learn_max_length   (0)
+  , learn_callback     (NULL)
+  , import_state       (NULL)
+  , import_callback    (NULL)
+  , exported_units     (0)
   , incremental(opt_incremental)
   , nbVarsInitialFormula(INT32_MAX)
 {
@@ -451,8 +460,7 @@ void Solver::cancelUntil(int level) {
         for (int c = trail.size()-1; c >= trail_lim[level]; c--){
             Var      x  = var(trail[c]);
             assigns [x] = l_Undef;
-            if (symmetry != nullptr)
-                symmetry->updateCancel(trail[c]);
+            hooks.onBacktrack(trail[c]);
 	    if (phase_saving > 1 || ((phase_saving == 1) && c > trail_lim.last()))
                 polarity[x] = sign(trail[c]);
             insertVarOrder(x); }
@@ -485,7 +493,7 @@ Lit Solver::pickBranchLit()
         }else
             next = order_heap.removeMin();
 
-    return next == var_Undef ? lit_Undef : mkLit(next, rnd_pol ? drand(random_seed) < 0.5 : polarity[next]);
+    return next == var_Undef ? lit_Undef : hooks.onDecide(mkLit(next, rnd_pol ? drand(random_seed) < 0.5 : polarity[next]));
 }
 
 
@@ -766,6 +774,7 @@ void Solver::uncheckedEnqueue(Lit p, CRef from)
     assigns[var(p)] = lbool(!sign(p));
     vardata[var(p)] = mkVarData(from, decisionLevel());
     trail.push_(p);
+    hooks.onEnqueue(p, decisionLevel(), from == CRef_Undef);
 }
 
 
@@ -792,12 +801,11 @@ CRef Solver::propagate()
         Watcher        *i, *j, *end;
         num_props++;
 
-       if (symmetry != nullptr) {
-            symmetry->updateNotify(p);
-            confl = learntSymmetryClause(cosy::ClauseInjector::ESBP, p);
-            if (confl != CRef_Undef)
-                return confl;
-        }
+        confl = injectSymmetryClauses(p);
+        if (confl != CRef_Undef)
+            return confl;
+        if (value(p) != l_True)         // Backjumped below p
+            continue;
 
 	    // First, Propagate binary clauses
 	vec<Watcher>&  wbin  = watchesBin[p];
@@ -949,6 +957,7 @@ void Solver::reduceDB()
   for (i = j = 0; i < learnts.size(); i++){
     Clause& c = ca[learnts[i]];
     if (c.lbd()>2 && c.size() > 2 && c.canBeDel() &&  !locked(c) && (i < limit)) {
+      hooks.onDelete(c, c.size());
       removeClause(learnts[i]);
       nbRemovedClauses++;
     }
@@ -1046,6 +1055,12 @@ lbool Solver::search(int nof_conflicts)
     starts++;
     for (;;){
         CRef confl = propagate();
+        // Symmetric implications once the clauses reached a fixpoint
+        while (confl == CRef_Undef && hooks.enabled() && symmetry->hasSymmetricImplication()){
+            confl = propagateSymmetries();
+            if (confl == CRef_Undef)
+                confl = propagate();
+        }
         if (confl != CRef_Undef){
             // CONFLICT
 	  conflicts++; conflictC++;conflictsRestarts++;
@@ -1088,6 +1103,17 @@ lbool Solver::search(int nof_conflicts)
               fprintf(certifiedOutput, "0\n");
             }
 
+            if (learn_callback != NULL && learnt_clause.size() <= learn_max_length) {
+              vec<int> exported;
+              for (int i = 0; i < learnt_clause.size(); i++)
+                exported.push((var(learnt_clause[i]) + 1) * (-2 * sign(learnt_clause[i]) + 1));
+              exported.push(0);
+              learn_callback(learn_state, (int*)exported);
+            }
+
+            if (learnt_clause.size() > 1)
+                hooks.onLearnt(learnt_clause, learnt_clause.size());
+
             if (learnt_clause.size() == 1){
 	      uncheckedEnqueue(learnt_clause[0]);nbUn++;
             }else{
@@ -1117,9 +1143,25 @@ lbool Solver::search(int nof_conflicts)
 	      bt = (decisionLevel()<assumptions.size()) ? decisionLevel() : assumptions.size();
 	    }
 	    cancelUntil(bt);
+	    hooks.onRestart(bt);
 	    return l_Undef; }
 
 
+            // Units of a DYNAMIC order hold at level 0
+            if (symmetry_units.size() > 0){
+                cancelUntil(0);
+                for (int i = 0; i < symmetry_units.size(); i++){
+                    Lit l = symmetry_units[i];
+                    if (value(l) == l_False){
+                        symmetry_units.clear();
+                        return l_False;
+                    }else if (value(l) == l_Undef)
+                        uncheckedEnqueue(l);
+                }
+                symmetry_units.clear();
+                continue;
+            }
+
            // Simplify the set of problem clauses:
 	  if (decisionLevel() == 0 && !simplify()) {
 	    return l_False;
@@ -1156,7 +1198,8 @@ lbool Solver::search(int nof_conflicts)
                 next = pickBranchLit();
 
                 if (next == lit_Undef){
-		  printf("c last restart ## conflicts  :  %d %d \n",conflictC,decisionLevel());
+		  if (verbosity >= 1)
+		      printf("c last restart ## conflicts  :  %d %d \n",conflictC,decisionLevel());
 		  // Model found:
 		  return l_True;
 		}
@@ -1215,10 +1258,17 @@ lbool Solver::solve_()
     exit(-1);
   }
 
+  hooks.setController(symmetry.get());
   if (symmetry != nullptr) {
-        symmetry->enableCosy(cosy::OrderMode::AUTO,
-                             cosy::ValueMode::TRUE_LESS_FALSE);
-        symmetry->printInfo();
+        symmetry->enableCosy(cosy_options);
+        if (verbosity >= 1)
+            symmetry->printInfo();
+
+        // Only the symmetries stabilizing the assumptions are used
+        std::vector<Lit> assumps;
+        for (int i = 0; i < assumptions.size(); i++)
+            assumps.push_back(assumptions[i]);
+        symmetry->beginSolve(assumps);
 
         cosy::ClauseInjector::Type type = cosy::ClauseInjector::UNITS;
 	while (symmetry->hasClauseToInject(type)) {
@@ -1268,6 +1318,8 @@ printf("c ==================================[ Search Statistics (every %6d confl
       status = search(0); // the parameter is useless in glucose, kept to allow modifications
 
         if (!withinBudget()) break;
+        if (status == l_Undef && decisionLevel() == 0 && !exchangeClauses())
+            status = l_False;
         curr_restarts++;
     }
 
@@ -1441,21 +1493,182 @@ void Solver::garbageCollect()
     to.moveTo(ca);
 }
 
-CRef Solver::learntSymmetryClause(cosy::ClauseInjector::Type type, Lit p) {
-    if (symmetry != nullptr) {
-        if (symmetry->hasClauseToInject(type, p)) {
-            std::vector<Lit> vsbp = symmetry->clauseToInject(type, p);
+// Attach the clauses given by cosy because of p and enqueue those that are
+// unit. Return the first conflicting one.
+CRef Solver::injectSymmetryClauses(Lit p) {
+    if (!hooks.pendingClauses(p, &inject_pending))
+        return CRef_Undef;
+    return attachSymmetryClauses(inject_pending);
+}
 
-            // Dirty make a copy of vector
-            vec<Lit> sbp;
-            for (Lit l : vsbp) {
-                sbp.push(l);
-            }
-            CRef cr = ca.alloc(sbp, true);
-            learnts.push(cr);
-            attachClause(cr);
-            return cr;
+CRef Solver::attachSymmetryClauses(const std::vector<cosy::SolverHooks<Lit>::PendingClause>& clauses) {
+    CRef confl = CRef_Undef;
+    CRef late  = CRef_Undef;     // Falsified below the current level
+
+    for (const cosy::SolverHooks<Lit>::PendingClause& pending : clauses) {
+        vec<Lit> sbp;
+        for (Lit l : pending.literals)
+            sbp.push(l);
+
+        // A DYNAMIC order gives units during search, see search()
+        if (sbp.size() == 1){
+            symmetry_units.push(sbp[0]);
+            continue;
+        }
+
+        // Watch the literals that are not false, or falsified last
+        for (int k = 0; k < 2 && k < sbp.size(); k++) {
+            int best = k;
+            for (int m = k + 1; m < sbp.size(); m++)
+                if (value(sbp[best]) == l_False &&
+                    (value(sbp[m]) != l_False || level(var(sbp[m])) > level(var(sbp[best]))))
+                    best = m;
+            Lit tmp = sbp[k]; sbp[k] = sbp[best]; sbp[best] = tmp;
+        }
+
+        CRef cr = ca.alloc(sbp, true);
+        if (pending.lbd > 0)
+            ca[cr].setLBD(pending.lbd);
+        learnts.push(cr);
+        attachClause(cr);
+
+        if (confl != CRef_Undef)
+            continue;
+        const Clause& c = ca[cr];
+        if (value(c[0]) == l_False) {
+            if (level(var(c[0])) == decisionLevel())
+                confl = cr;
+            else if (late == CRef_Undef || level(var(c[0])) < level(var(ca[late][0])))
+                late = cr;
+        } else if (value(c[0]) == l_Undef && value(c[1]) == l_False) {
+            uncheckedEnqueue(c[0], cr);
+        }
+    }
+
+    // Backjump so that the clause is unit at its second highest level, or
+    // conflicting at its highest one when both levels are the same
+    if (confl == CRef_Undef && late != CRef_Undef) {
+        const Clause& c = ca[late];
+        int highest = level(var(c[0])), second = level(var(c[1]));
+        if (second < highest) {
+            cancelUntil(second);
+            uncheckedEnqueue(c[0], late);
+        } else {
+            cancelUntil(highest);
+            confl = late;
+        }
+    }
+    return confl;
+}
+
+// The symmetries weakly active when a literal was propagated imply its
+// images, the image of its reason being their reason (see
+// cosy/SymmetryPropagator.h). It is only used when the other literals are
+// false, as a reason or a conflict.
+CRef Solver::propagateSymmetries() {
+    inject_pending.clear();
+    while (symmetry->hasSymmetricImplication()) {
+        Lit implied = symmetry->symmetricImplication();
+        if (value(implied) == l_True){
+            symmetry->discardSymmetricImplication(implied);
+            continue;
+        }
+
+        symmetry_source.clear();
+        if (!symmetryReason(symmetry->symmetricImplicationSource(implied), &symmetry_source)){
+            symmetry->discardSymmetricImplication(implied);
+            continue;
+        }
+        std::vector<Lit> image = symmetry->symmetricImplicationReason(implied, symmetry_source);
+
+        bool falsified = image.size() > 1;
+        for (size_t i = 1; i < image.size() && falsified; i++)
+            falsified = value(image[i]) == l_False;
+        if (!falsified){
+            symmetry->discardSymmetricImplication(implied);
+            continue;
+        }
+
+        inject_pending.emplace_back();
+        inject_pending.back().type = cosy::ClauseInjector::SYMMETRIC_LEARNT;
+        inject_pending.back().literals = std::move(image);
+        inject_pending.back().lbd = 0;
+    }
+    return attachSymmetryClauses(inject_pending);
+}
+
+bool Solver::exchangeClauses() {
+    if (learn_callback != NULL && learn_max_length >= 1) {
+        for (; exported_units < trail.size(); exported_units++) {
+            int unit[2] = { (var(trail[exported_units]) + 1) * (-2 * sign(trail[exported_units]) + 1), 0 };
+            learn_callback(learn_state, unit);
         }
     }
-    return CRef_Undef;
+
+    if (import_callback == NULL)
+        return true;
+    for (const int* clause = import_callback(import_state); clause != NULL; clause = import_callback(import_state)) {
+        import_tmp.clear();
+        for (; *clause != 0; clause++)
+            import_tmp.push(mkLit(abs(*clause) - 1, *clause < 0));
+        if (!addImportedClause(import_tmp))
+            return false;
+    }
+    return true;
+}
+
+bool Solver::addImportedClause(vec<Lit>& ps) {
+    assert(decisionLevel() == 0);
+    if (!ok) return false;
+
+    // Same simplification as addClause_(), the clause is then kept as learnt so that reduceDB() can remove it
+    sort(ps);
+    Lit p; int i, j;
+    for (i = j = 0, p = lit_Undef; i < ps.size(); i++)
+        if (value(ps[i]) == l_True || ps[i] == ~p)
+            return true;
+        else if (value(ps[i]) != l_False && ps[i] != p)
+            ps[j++] = p = ps[i];
+    ps.shrink(i - j);
+
+    if (ps.size() == 0)
+        return ok = false;
+    else if (ps.size() == 1){
+        uncheckedEnqueue(ps[0]);
+        return ok = (propagate() == CRef_Undef);
+    }else{
+        CRef cr = ca.alloc(ps, true);
+        ca[cr].setLBD(ps.size());
+        learnts.push(cr);
+        attachClause(cr);
+    }
+    return true;
+}
+
+bool Solver::symmetryReason(Lit p, std::vector<Lit> *literals) const {
+    CRef cr = reason(var(p));
+    if (cr == CRef_Undef)
+        return false;
+
+    const Clause& c = ca[cr];
+    for (int i = 0; i < c.size(); i++)
+        if (var(c[i]) != var(p))
+            literals->push_back(c[i]);
+    return true;
+}
+
+void Solver::addClausesTo(cosy::SymmetryController<Lit>& symmetry) const {
+    std::vector<Lit> literals;
+
+    for (int i = 0; i < clauses.size(); i++) {
+        const Clause& c = ca[clauses[i]];
+        literals.clear();
+        for (int j = 0; j < c.size(); j++)
+            literals.push_back(c[j]);
+        symmetry.addClause(literals.data(), literals.size());
+    }
+
+    assert(decisionLevel() == 0);
+    for (int i = 0; i < trail.size(); i++)
+        symmetry.addClause(&trail[i], 1);
 }
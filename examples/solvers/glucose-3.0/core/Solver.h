@@ -39,6 +39,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include "core/BoundedQueue.h"
 #include "core/Constants.h"
 
+#include "cosy/SolverHooks.h"
 #include "cosy/SymmetryController.h"
 
 namespace Glucose {
@@ -68,7 +69,14 @@ public:
 
     // Symmetry
     std::unique_ptr<cosy::SymmetryController<Lit>> symmetry;
-    CRef learntSymmetryClause(cosy::ClauseInjector::Type type, Lit p);
+    cosy::CosyOptions cosy_options;                     // Applied by solve_()
+    cosy::SolverHooks<Lit> hooks;                       // Set by solve_()
+    CRef injectSymmetryClauses(Lit p);                  // Attach the clauses given for p, return a conflict
+    CRef attachSymmetryClauses(const std::vector<cosy::SolverHooks<Lit>::PendingClause>& pending);  // Attach clauses implied with the symmetries, return a conflict
+    CRef propagateSymmetries();                         // Attach the images of reasons that are unit or conflicting, return a conflict
+    vec<Lit> symmetry_units;                            // Units injected during search, enqueued at level 0
+    bool symmetryReason(Lit p, std::vector<Lit> *literals) const;  // Other literals of the reason of p
+    void addClausesTo(cosy::SymmetryController<Lit>& symmetry) const;  // Give the clauses and level 0 units
 
     // Solving:
     //
@@ -122,6 +130,11 @@ public:
     void    budgetOff();
     void    interrupt();          // Trigger a (potentially asynchronous) interruption of the solver.
     void    clearInterrupt();     // Clear interrupt indicator flag.
+    void    setTerminateCallback(void* state, int (*terminate)(void* state));              // Polled at each restart (IPASIR).
+    void    setLearnCallback(void* state, int max_length, void (*learn)(void* state, int* clause)); // Learnt clauses as 0 ended DIMACS (IPASIR).
+    void    setImportCallback(void* state, const int* (*import)(void* state)); // Clauses of other solvers as 0 ended DIMACS, NULL when none
+                                                                // left. Polled at each restart at level 0, which also gives the new
+                                                                // level 0 units to the learn callback (see portfolio/).
 
     // Memory managment:
     //
@@ -259,6 +272,9 @@ protected:
     vec<Lit>            analyze_stack;
     vec<Lit>            analyze_toclear;
     vec<Lit>            add_tmp;
+    std::vector<cosy::SolverHooks<Lit>::PendingClause> inject_pending;
+    std::vector<Lit>    symmetry_source;
+    vec<Lit>            import_tmp;
     unsigned int  MYFLAG;
 
 
@@ -271,6 +287,14 @@ protected:
     int64_t             conflict_budget;    // -1 means no budget.
     int64_t             propagation_budget; // -1 means no budget.
     bool                asynch_interrupt;
+    void*               terminate_state;    // IPASIR callbacks (see ipasir/)
+    int               (*terminate_callback)(void* state);
+    void*               learn_state;
+    int                 learn_max_length;
+    void              (*learn_callback)(void* state, int* clause);
+    void*               import_state;
+    const int*        (*import_callback)(void* state);
+    int                 exported_units;     // Level 0 literals already given to the learn callback
 
 
     // Variables added for incremental mode
@@ -295,6 +319,8 @@ protected:
     bool     litRedundant     (Lit p, uint32_t abstract_levels);                       // (helper method for 'analyze()')
     lbool    search           (int nof_conflicts);                                     // Search for a given number of conflicts.
     lbool    solve_           ();                                                      // Main solve method (assumptions given in 'assumptions').
+    bool     exchangeClauses  ();                                                      // Export new level 0 units and import clauses, false if UNSAT.
+    bool     addImportedClause(vec<Lit>& ps);                                          // Add a clause of another solver as learnt, at level 0.
     void     reduceDB         ();                                                      // Reduce the set of learnt clauses.
     void     removeSatisfied  (vec<CRef>& cs);                                         // Shrink 'cs' to contain only non-satisfied clauses.
     void     rebuildOrderHeap ();
@@ -423,9 +449,13 @@ inline void     Solver::setConfBudget(int64_t x){ conflict_budget    = conflicts
 inline void     Solver::setPropBudget(int64_t x){ propagation_budget = propagations + x; }
 inline void     Solver::interrupt(){ asynch_interrupt = true; }
 inline void     Solver::clearInterrupt(){ asynch_interrupt = false; }
+inline void     Solver::setTerminateCallback(void* state, int (*terminate)(void*)){ terminate_state = state; terminate_callback = terminate; }
+inline void     Solver::setLearnCallback(void* state, int max_length, void (*learn)(void*, int*)){ learn_state = state; learn_max_length = max_length; learn_callback = learn; }
+inline void     Solver::setImportCallback(void* state, const int* (*import)(void*)){ import_state = state; import_callback = import; }
 inline void     Solver::budgetOff(){ conflict_budget = propagation_budget = -1; }
 inline bool     Solver::withinBudget() const {
     return !asynch_interrupt &&
+           (terminate_callback == NULL || !terminate_callback(terminate_state)) &&
            (conflict_budget    < 0 || conflicts < (uint64_t)conflict_budget) &&
            (propagation_budget < 0 || propagations < (uint64_t)propagation_budget); }
 
@@ -0,0 +1,270 @@
+// IPASIR interface of glucose with cosy symmetry breaking.
+//
+// The clauses are kept by the wrapper: ESBP are not implied by the formula,
+// only by the formula and its symmetries, so a solver that has used them
+// can not be given new clauses or assumptions that break these symmetries.
+// Such a solver is rebuilt from the kept clauses, with a group computed
+// again, before the next search. Under assumptions, only the symmetries
+// that map the set of assumptions on itself are broken, and the solver is
+// kept as long as the clauses it was given stay sound for the new
+// assumptions (see SymmetryController::canSolveUnder()).
+//
+// Cosy options are read from the COSY_OPTIONS environment variable, e.g.
+// COSY_OPTIONS="order=dynamic,esbp_forcing=1" (see cosy/CosyOptions.h).
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "core/GlucoseLiteralAdapter.h"
+#include "core/GlucoseReasonProvider.h"
+#include "core/Solver.h"
+#include "ipasir/ipasir.h"
+
+using namespace Glucose;
+
+namespace {
+
+class IpasirSolver {
+ public:
+    IpasirSolver() :
+        adapter(new GlucoseLiteralAdapter()),
+        num_vars(0),
+        symmetric(false),
+        stale(false),
+        terminate_state(NULL),
+        terminate_callback(NULL),
+        learn_state(NULL),
+        learn_max_length(0),
+        learn_callback(NULL) {
+        const char* spec = getenv("COSY_OPTIONS");
+        if (spec != NULL && !options.parse(spec))
+            fprintf(stderr, "c ignoring bad COSY_OPTIONS: %s\n", spec);
+    }
+
+    ~IpasirSolver() {
+        resetSymmetry();
+    }
+
+    void add(int lit_or_zero) {
+        if (lit_or_zero != 0) {
+            num_vars = std::max(num_vars, abs(lit_or_zero));
+            clause.push_back(lit_or_zero);
+            return;
+        }
+        clauses.insert(clauses.end(), clause.begin(), clause.end());
+        clauses.push_back(0);
+
+        // A solver with symmetries must see the new clause with the group
+        // it breaks, the other ones are incremental
+        if (solver && !symmetric)
+            addClause(clause);
+        else
+            stale = true;
+        clause.clear();
+    }
+
+    void assume(int lit) {
+        num_vars = std::max(num_vars, abs(lit));
+        assumptions.push_back(lit);
+    }
+
+    int solve() {
+        std::vector<Lit> literals;
+        for (const int& lit : assumptions)
+            literals.push_back(toLit(lit));
+
+        // The group of a symmetric solver does not know new variables
+        if (!solver || stale ||
+            (symmetric && (solver->nVars() < num_vars ||
+                           !solver->symmetry->canSolveUnder(literals))))
+            rebuild();
+
+        vec<Lit> assumps;
+        for (const int& lit : assumptions) {
+            reserveVariable(lit);
+            assumps.push(toLit(lit));
+        }
+        assumptions.clear();
+
+        solver->budgetOff();
+        const lbool result = solver->solveLimited(assumps);
+
+        if (result == l_True)  return 10;
+        if (result == l_False) return 20;
+        return 0;
+    }
+
+    int val(int lit) const {
+        const int v = abs(lit) - 1;
+        if (!solver || v >= solver->model.size() || solver->model[v] == l_Undef)
+            return 0;
+        const bool is_true = (solver->model[v] == l_True) == (lit > 0);
+        return is_true ? lit : -lit;
+    }
+
+    int failed(int lit) const {
+        if (!solver)
+            return 0;
+        const Lit p = ~toLit(lit);
+        for (int i = 0; i < solver->conflict.size(); i++)
+            if (solver->conflict[i] == p)
+                return 1;
+        return 0;
+    }
+
+    void setTerminate(void* state, int (*callback)(void*)) {
+        terminate_state = state;
+        terminate_callback = callback;
+        if (solver)
+            solver->setTerminateCallback(state, callback);
+    }
+
+    void setLearn(void* state, int max_length, void (*callback)(void*, int*)) {
+        learn_state = state;
+        learn_max_length = max_length;
+        learn_callback = callback;
+        if (solver && !symmetric)
+            exportLearnts();
+    }
+
+ private:
+    std::unique_ptr<Solver> solver;
+    std::unique_ptr<GlucoseReasonProvider> reasons;
+    std::unique_ptr<cosy::LiteralAdapter<Lit>> adapter;
+    cosy::CosyOptions options;
+
+    std::vector<int> clauses;   // all the clauses, each ended by 0
+    std::vector<int> clause;
+    std::vector<int> assumptions;
+
+    int num_vars;        // in the clauses and the assumptions
+    bool symmetric;      // the solver injects ESBP
+    bool stale;          // clauses were added since the solver was built
+
+    void* terminate_state;
+    int (*terminate_callback)(void*);
+    void* learn_state;
+    int learn_max_length;
+    void (*learn_callback)(void*, int*);
+
+    static Lit toLit(int lit) { return mkLit(abs(lit) - 1, lit < 0); }
+
+    void reserveVariable(int lit) {
+        while (solver->nVars() < abs(lit))
+            solver->newVar();
+    }
+
+    void addClause(const std::vector<int>& literals) {
+        vec<Lit> lits;
+        for (const int& lit : literals) {
+            reserveVariable(lit);
+            lits.push(toLit(lit));
+        }
+        solver->addClause_(lits);
+    }
+
+    void exportLearnts() {
+        solver->setLearnCallback(learn_state, learn_max_length,
+                                 learn_callback);
+    }
+
+    void rebuild() {
+        resetSymmetry();
+        solver.reset(new Solver());
+        solver->verbosity = 0;
+        solver->setTerminateCallback(terminate_state, terminate_callback);
+        reserveVariable(num_vars);
+
+        std::vector<int> literals;
+        for (const int& lit : clauses) {
+            if (lit != 0) {
+                literals.push_back(lit);
+                continue;
+            }
+            addClause(literals);
+            literals.clear();
+        }
+
+        symmetric = false;
+        stale = false;
+
+        if (solver->okay()) {
+            solver->cosy_options = options;
+            solver->symmetry =
+                std::unique_ptr<cosy::SymmetryController<Lit>>
+                (new cosy::SymmetryController<Lit>(solver->nVars(), adapter));
+            solver->addClausesTo(*solver->symmetry);
+            solver->symmetry->findSymmetries(options.finder);
+
+            if (solver->symmetry->group().numberOfPermutations() > 0) {
+                reasons.reset(new GlucoseReasonProvider(*solver));
+                solver->symmetry->setReasonProvider(reasons.get());
+                symmetric = true;
+            } else {
+                solver->symmetry.reset();
+            }
+        }
+
+        // Learnt clauses may depend on ESBP, they are not implied by the
+        // formula alone
+        if (!symmetric)
+            exportLearnts();
+    }
+
+    void resetSymmetry() {
+        if (solver)
+            solver->symmetry.reset();
+        reasons.reset();
+    }
+};
+
+}  // namespace
+
+extern "C" {
+
+const char* ipasir_signature() {
+    return "glucose-3.0+cosy";
+}
+
+void* ipasir_init() {
+    return new IpasirSolver();
+}
+
+void ipasir_release(void* solver) {
+    delete static_cast<IpasirSolver*>(solver);
+}
+
+void ipasir_add(void* solver, int lit_or_zero) {
+    static_cast<IpasirSolver*>(solver)->add(lit_or_zero);
+}
+
+void ipasir_assume(void* solver, int lit) {
+    static_cast<IpasirSolver*>(solver)->assume(lit);
+}
+
+int ipasir_solve(void* solver) {
+    return static_cast<IpasirSolver*>(solver)->solve();
+}
+
+int ipasir_val(void* solver, int lit) {
+    return static_cast<IpasirSolver*>(solver)->val(lit);
+}
+
+int ipasir_failed(void* solver, int lit) {
+    return static_cast<IpasirSolver*>(solver)->failed(lit);
+}
+
+void ipasir_set_terminate(void* solver, void* data,
+                          int (*terminate)(void* data)) {
+    static_cast<IpasirSolver*>(solver)->setTerminate(data, terminate);
+}
+
+void ipasir_set_learn(void* solver, void* data, int max_length,
+                      void (*learn)(void* data, int* clause)) {
+    static_cast<IpasirSolver*>(solver)->setLearn(data, max_length, learn);
+}
+
+}  // extern "C"
@@ -0,0 +1,113 @@
+// Lock-free exchange of short clauses between the workers of the portfolio.
+//
+// Each worker publishes in its own ring buffer, so a ring has a single
+// writer and needs no lock. Readers keep a cursor per ring. A slot is
+// guarded by a sequence number (seqlock): odd while it is written, then
+// 2 * (index + 1), so a reader detects a slot overwritten while it was
+// copied and skips it. A reader that falls more than a ring behind loses
+// the oldest clauses, which is fine for learnt clauses.
+//
+// Clauses are tagged with the family of their worker: clauses of family 0
+// are implied by the formula and go to every worker, the other ones only
+// to the workers of the same family (see Main.cc).
+
+#ifndef Glucose_ClauseExchange_h
+#define Glucose_ClauseExchange_h
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Glucose {
+
+class ClauseExchange {
+ public:
+    static const int kMaxSize = 8;        // longest shared clause
+    static const uint64_t kCapacity = 1 << 14;  // slots per worker
+
+    explicit ClauseExchange(int num_workers) :
+        rings(new Ring[num_workers]),
+        num_rings(num_workers) {}
+
+    // Clause as 0 ended DIMACS, longer clauses are ignored.
+    void publish(int worker, int family, const int* clause) {
+        int size = 0;
+        while (clause[size] != 0)
+            if (++size > kMaxSize)
+                return;
+
+        Ring& ring = rings[worker];
+        const uint64_t index = ring.head.load(std::memory_order_relaxed);
+        Slot& slot = ring.slots[index % kCapacity];
+
+        slot.seq.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.family.store(family, std::memory_order_relaxed);
+        slot.size.store(size, std::memory_order_relaxed);
+        for (int i = 0; i < size; i++)
+            slot.literals[i].store(clause[i], std::memory_order_relaxed);
+        slot.seq.store(2 * (index + 1), std::memory_order_release);
+        ring.head.store(index + 1, std::memory_order_release);
+    }
+
+    // Append to clauses, as 0 ended DIMACS, the clauses of the other
+    // workers published since the last call that worker may use.
+    void collect(int worker, int family, std::vector<uint64_t>& cursors,
+                 std::vector<int>& clauses) const {
+        cursors.resize(num_rings, 0);
+        int literals[kMaxSize];
+
+        for (int r = 0; r < num_rings; r++) {
+            if (r == worker)
+                continue;
+            const Ring& ring = rings[r];
+            const uint64_t head = ring.head.load(std::memory_order_acquire);
+            uint64_t& cursor = cursors[r];
+            if (head - cursor > kCapacity)
+                cursor = head - kCapacity;
+
+            for (; cursor < head; cursor++) {
+                const Slot& slot = ring.slots[cursor % kCapacity];
+                const uint64_t seq = slot.seq.load(std::memory_order_acquire);
+                if (seq != 2 * (cursor + 1))
+                    continue;
+                const int tag = slot.family.load(std::memory_order_relaxed);
+                const int size = slot.size.load(std::memory_order_relaxed);
+                for (int i = 0; i < size && i < kMaxSize; i++)
+                    literals[i] = slot.literals[i].load(std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (slot.seq.load(std::memory_order_relaxed) != seq)
+                    continue;
+
+                if (tag != 0 && (family <= 0 || tag != family))
+                    continue;
+                clauses.insert(clauses.end(), literals, literals + size);
+                clauses.push_back(0);
+            }
+        }
+    }
+
+ private:
+    struct Slot {
+        Slot() : seq(0), family(0), size(0) {}
+        std::atomic<uint64_t> seq;
+        std::atomic<int> family;
+        std::atomic<int> size;
+        std::atomic<int> literals[kMaxSize];
+    };
+
+    struct Ring {
+        Ring() : head(0), slots(new Slot[kCapacity]) {}
+        std::atomic<uint64_t> head;
+        std::unique_ptr<Slot[]> slots;
+    };
+
+    std::unique_ptr<Ring[]> rings;
+    int num_rings;
+};
+
+}
+
+#endif
@@ -0,0 +1,270 @@
+// Portfolio of glucose workers running in threads, diversified by their
+// cosy settings: order, value mode, ESBP, forcing, symmetric learning,
+// symmetry propagation, polarity and sleep. The symmetries and the default
+// order are computed once and shared by the workers (see
+// cosy/SymmetryData.h), the workers of other orders build their own. The
+// first worker to finish wins, the other ones are stopped through their
+// terminate callback.
+//
+// Workers exchange learnt clauses of at most ClauseExchange::kMaxSize
+// literals and level 0 units. A clause learnt with symmetry breaking
+// clauses is only implied by the formula and a lex-leader constraint, so
+// each worker has a family:
+//   - 0, workers without symmetry breaking: their clauses go to everyone,
+//   - one per (order, value) pair: the lex-leader constraint of the whole
+//     group for this order implies the clauses of every such worker,
+//   - -1, workers with a dynamic order, symmetric learning or symmetry
+//     propagation: nothing is exported, their clauses are not implied by
+//     one lex-leader constraint.
+// A worker imports the clauses of family 0 and of its own family.
+
+#include <errno.h>
+#include <stdlib.h>
+#include <zlib.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "utils/System.h"
+#include "utils/ParseUtils.h"
+#include "utils/Options.h"
+#include "core/Dimacs.h"
+#include "core/Solver.h"
+
+#include "core/GlucoseLiteralAdapter.h"
+#include "core/GlucoseReasonProvider.h"
+#include "cosy/SymmetryController.h"
+#include "portfolio/ClauseExchange.h"
+
+using namespace Glucose;
+
+namespace {
+
+// Cosy options of the workers, NULL runs glucose without symmetries.
+// Workers beyond this list reuse it with random initial activities.
+const char* kConfigs[] = {
+    "",
+    NULL,
+    "order=dynamic,esbp_forcing=1",
+    "order=occurence,value=false_less_true,symmetric_polarity=1",
+    "esbp=0,symmetric_learning=1",
+    "esbp=0,symmetry_propagation=1",
+    "level_zero_simplification=1,sleep_check_period=4096",
+    "order=breakid,esbp_forcing=1",
+    "esbp_forcing=1,symmetric_polarity=1",
+    "order=increase,value=false_less_true,esbp_minimization=reasons",
+};
+const int kNumConfigs = sizeof(kConfigs) / sizeof(kConfigs[0]);
+
+int familyOf(const cosy::CosyOptions& options, bool symmetric) {
+    if (!symmetric)
+        return 0;
+    if (options.order == cosy::DYNAMIC || options.symmetric_learning ||
+        options.symmetry_propagation)
+        return -1;
+    return 1 + 2 * options.order + options.value;
+}
+
+class Worker {
+ public:
+    Worker(int index, ClauseExchange& exchange, std::atomic<int>& winner) :
+        index(index),
+        family(0),
+        symmetric(false),
+        result(l_Undef),
+        exchange(exchange),
+        winner(winner),
+        import_index(0) {
+        solver.verbosity = 0;
+        solver.setTerminateCallback(this, terminate);
+        solver.setImportCallback(this, import);
+        // Before load(): initial activities are given by newVar()
+        if (index >= kNumConfigs) {
+            solver.rnd_init_act = true;
+            solver.random_seed += index;
+        }
+    }
+
+    void configure(const std::shared_ptr<const cosy::SymmetryData>& data,
+                   const std::unique_ptr<cosy::LiteralAdapter<Lit>>& adapter) {
+        const char* config = kConfigs[index % kNumConfigs];
+        symmetric = config != NULL && data->group().numberOfPermutations() > 0;
+        if (symmetric) {
+            solver.cosy_options.parse(config);
+            solver.symmetry = std::unique_ptr<cosy::SymmetryController<Lit>>
+                (new cosy::SymmetryController<Lit>(data, adapter));
+            reasons.reset(new GlucoseReasonProvider(solver));
+            solver.symmetry->setReasonProvider(reasons.get());
+        }
+
+        family = familyOf(solver.cosy_options, symmetric);
+        if (family >= 0)
+            solver.setLearnCallback(this, ClauseExchange::kMaxSize, learn);
+    }
+
+    // Parse the formula, false if it is not readable.
+    bool load(const char* filename) {
+        gzFile in = gzopen(filename, "rb");
+        if (in == NULL)
+            return false;
+        parse_DIMACS(in, solver);
+        gzclose(in);
+        return true;
+    }
+
+    void run() {
+        vec<Lit> dummy;
+        if (!solver.simplify())
+            result = l_False;
+        else
+            result = solver.solveLimited(dummy);
+
+        int none = -1;
+        if (result != l_Undef)
+            winner.compare_exchange_strong(none, index);
+    }
+
+    std::string description() const {
+        if (!symmetric)
+            return "glucose without symmetries";
+        return "cosy " + solver.cosy_options.toString();
+    }
+
+    Solver solver;
+    const int index;
+    int family;
+    bool symmetric;
+    lbool result;
+
+ private:
+    ClauseExchange& exchange;
+    std::atomic<int>& winner;
+    std::unique_ptr<GlucoseReasonProvider> reasons;
+    std::vector<uint64_t> cursors;
+    std::vector<int> imported;
+    size_t import_index;
+
+    static int terminate(void* state) {
+        return static_cast<Worker*>(state)->winner.load(std::memory_order_relaxed) >= 0;
+    }
+
+    static void learn(void* state, int* clause) {
+        Worker* worker = static_cast<Worker*>(state);
+        worker->exchange.publish(worker->index, worker->family, clause);
+    }
+
+    // Clauses are collected once per restart: NULL ends the round
+    static const int* import(void* state) {
+        Worker* worker = static_cast<Worker*>(state);
+        if (worker->imported.empty())
+            worker->exchange.collect(worker->index, worker->family,
+                                     worker->cursors, worker->imported);
+        if (worker->import_index >= worker->imported.size()) {
+            worker->imported.clear();
+            worker->import_index = 0;
+            return NULL;
+        }
+        const int* clause = &worker->imported[worker->import_index];
+        while (worker->imported[worker->import_index] != 0)
+            worker->import_index++;
+        worker->import_index++;
+        return clause;
+    }
+};
+
+}  // namespace
+
+//=================================================================================================
+// Main:
+
+int main(int argc, char** argv)
+{
+    printf("c\nc This is glucose 3.0 portfolio --  based on MiniSAT (Many thanks to MiniSAT team)\nc\n");
+    try {
+        setUsageHelp("c USAGE: %s [options] <input-file> <result-output-file>\n\n  where input may be either in plain or gzipped DIMACS.\n");
+
+        IntOption    num_workers("MAIN", "workers", "Number of worker threads.", 4, IntRange(1, 64));
+        IntOption    verb   ("MAIN", "verb",   "Verbosity level (0=silent, 1=some).", 1, IntRange(0, 1));
+        BoolOption   mod   ("MAIN", "model",   "show model.", false);
+
+        parseOptions(argc, argv, true);
+
+        if (argc < 2)
+            printf("c ERROR! No input file, use '--help' for help.\n"), exit(1);
+
+        ClauseExchange exchange(num_workers);
+        std::atomic<int> winner(-1);
+        std::vector<std::unique_ptr<Worker>> workers;
+        for (int i = 0; i < num_workers; i++)
+            workers.emplace_back(new Worker(i, exchange, winner));
+
+        // The symmetries are computed on the clauses of the first worker
+        if (!workers[0]->load(argv[1]))
+            printf("c ERROR! Could not open file: %s\n", argv[1]), exit(1);
+        std::unique_ptr<cosy::LiteralAdapter<Lit>> adapter(new GlucoseLiteralAdapter());
+        cosy::SymmetryController<Lit> builder(workers[0]->solver.nVars(), adapter);
+        workers[0]->solver.addClausesTo(builder);
+        builder.findSymmetries(cosy::SymmetryFinder::BLISS);
+        // The data keeps one static order: the default one, most used
+        builder.enableCosy(cosy::CosyOptions());
+        const std::shared_ptr<const cosy::SymmetryData> data = builder.sharedData();
+        if (verb > 0)
+            printf("c Symmetry generators   : %d\n", (int)data->group().numberOfPermutations());
+
+        std::vector<std::thread> threads;
+        for (int i = 0; i < num_workers; i++) {
+            threads.push_back(std::thread([&, i]() {
+                Worker& worker = *workers[i];
+                if (i > 0)
+                    worker.load(argv[1]);
+                worker.configure(data, adapter);
+                worker.run();
+            }));
+        }
+        for (std::thread& thread : threads)
+            thread.join();
+
+        const lbool ret = winner >= 0 ? workers[winner]->result : l_Undef;
+        if (verb > 0) {
+            for (const std::unique_ptr<Worker>& worker : workers)
+                printf("c worker %d (family %d) : %s\n", worker->index, worker->family, worker->description().c_str());
+            if (winner >= 0)
+                printf("c winner                : worker %d, %" PRIu64 " conflicts\n", (int)winner, workers[winner]->solver.conflicts);
+            printf("c CPU time              : %g s\n", cpuTime());
+        }
+
+        const Solver& S = winner >= 0 ? workers[winner]->solver : workers[0]->solver;
+        FILE* res = (argc >= 3) ? fopen(argv[argc-1], "wb") : NULL;
+        if (res != NULL){
+            if (ret == l_True){
+                fprintf(res, "SAT\n");
+                for (int i = 0; i < S.nVars(); i++)
+                    if (S.model[i] != l_Undef)
+                        fprintf(res, "%s%s%d", (i==0)?"":" ", (S.model[i]==l_True)?"":"-", i+1);
+                fprintf(res, " 0\n");
+            }else if (ret == l_False)
+                fprintf(res, "UNSAT\n");
+            else
+                fprintf(res, "INDET\n");
+            fclose(res);
+        } else {
+            printf(ret == l_True ? "s SATISFIABLE\n" : ret == l_False ? "s UNSATISFIABLE\n" : "s INDETERMINATE\n");
+            if (mod && ret == l_True) {
+                printf("v ");
+                for (int i = 0; i < S.nVars(); i++)
+                    if (S.model[i] != l_Undef)
+                        printf("%s%s%d", (i==0)?"":" ", (S.model[i]==l_True)?"":"-", i+1);
+                printf(" 0\n");
+            }
+        }
+
+        exit(ret == l_True ? 10 : ret == l_False ? 20 : 0);
+    } catch (OutOfMemoryException&){
+        printf("c ===================================================================================================\n");
+        printf("INDETERMINATE\n");
+        exit(0);
+    }
+}
@@ -91,10 +91,15 @@ int main(int argc, char** argv)
         IntOption    verb   ("MAIN", "verb",   "Verbosity level (0=silent, 1=some, 2=more).", 1, IntRange(0, 2));
         IntOption    cpu_lim("MAIN", "cpu-lim","Limit on CPU time allowed in seconds.\n", INT32_MAX, IntRange(0, INT32_MAX));
         IntOption    mem_lim("MAIN", "mem-lim","Limit on memory usage in megabytes.\n", INT32_MAX, IntRange(0, INT32_MAX));
+        StringOption cosy_opt("MAIN", "cosy", "Symmetry options, e.g. order=dynamic,esbp_forcing=1 (see cosy/CosyOptions.h).", "");
 
         parseOptions(argc, argv, true);
 
         Solver S;
+        if (cosy_opt && !S.cosy_options.parse(std::string(cosy_opt))) {
+            fprintf(stderr, "ERROR! bad -cosy option: %s\n", (const char*)cosy_opt);
+            exit(1);
+        }
         double initial_time = cpuTime();
 
         S.verbosity = verb;
@@ -174,7 +179,7 @@ int main(int argc, char** argv)
         S.symmetry = std::unique_ptr<cosy::SymmetryController<Minisat::Lit>>
             (new cosy::SymmetryController<Minisat::Lit>
              (cnf_file,
-              cosy::SymmetryFinder::Automorphism::BLISS,
+              S.cosy_options.finder,
               adapter));
 
         vec<Lit> dummy;
@@ -209,8 +209,7 @@ void Solver::cancelUntil(int level) {
         for (int c = trail.size()-1; c >= trail_lim[level]; c--){
             Var      x  = var(trail[c]);
             assigns [x] = l_Undef;
-	    if (symmetry != nullptr)
-                symmetry->updateCancel(trail[c]);
+            hooks.onBacktrack(trail[c]);
             if (phase_saving > 1 || (phase_saving == 1) && c > trail_lim.last())
                 polarity[x] = sign(trail[c]);
             insertVarOrder(x); }
@@ -242,7 +241,7 @@ Lit Solver::pickBranchLit()
         }else
             next = order_heap.removeMin();
 
-    return next == var_Undef ? lit_Undef : mkLit(next, rnd_pol ? drand(random_seed) < 0.5 : polarity[next]);
+    return next == var_Undef ? lit_Undef : hooks.onDecide(mkLit(next, rnd_pol ? drand(random_seed) < 0.5 : polarity[next]));
 }
 
 
@@ -434,10 +433,7 @@ void Solver::uncheckedEnqueue(Lit p, CRef from)
     assigns[var(p)] = lbool(!sign(p));
     vardata[var(p)] = mkVarData(from, decisionLevel());
     trail.push_(p);
-
-    if (symmetry != nullptr) {
-        symmetry->updateNotify(p, decisionLevel(), from == CRef_Undef);
-    }
+    hooks.onEnqueue(p, decisionLevel(), from == CRef_Undef);
 }
 
 
@@ -464,8 +460,12 @@ CRef Solver::propagate()
         Watcher        *i, *j, *end;
         num_props++;
 
-        learntSymmetryClause(cosy::ClauseInjector::ESBP, p);
-        learntSymmetryClause(cosy::ClauseInjector::ESBP_FORCING, p);
+        confl = injectSymmetryClauses(p);
+        if (confl != CRef_Undef){
+            qhead = trail.size();
+            break; }
+        if (value(p) != l_True)         // Backjumped below p
+            continue;
 
         for (i = j = (Watcher*)ws, end = i + ws.size();  i != end;){
             // Try to avoid inspecting the clause:
@@ -543,8 +543,10 @@ void Solver::reduceDB()
     // and clauses with activity smaller than 'extra_lim':
     for (i = j = 0; i < learnts.size(); i++){
         Clause& c = ca[learnts[i]];
-        if (c.size() > 2 && !locked(c) && (i < learnts.size() / 2 || c.activity() < extra_lim))
+        if (c.size() > 2 && !locked(c) && (i < learnts.size() / 2 || c.activity() < extra_lim)){
+            hooks.onDelete(c, c.size());
             removeClause(learnts[i]);
+        }
         else
             learnts[j++] = learnts[i];
     }
@@ -641,6 +643,9 @@ lbool Solver::search(int nof_conflicts)
             analyze(confl, learnt_clause, backtrack_level);
             cancelUntil(backtrack_level);
 
+            if (learnt_clause.size() > 1)
+                hooks.onLearnt(learnt_clause, learnt_clause.size());
+
             if (learnt_clause.size() == 1){
                 uncheckedEnqueue(learnt_clause[0]);
             }else{
@@ -672,8 +677,24 @@ lbool Solver::search(int nof_conflicts)
                 // Reached bound on number of conflicts:
                 progress_estimate = progressEstimate();
                 cancelUntil(0);
+                hooks.onRestart(0);
                 return l_Undef; }
 
+            // Units of a DYNAMIC order hold at level 0
+            if (symmetry_units.size() > 0){
+                cancelUntil(0);
+                for (int i = 0; i < symmetry_units.size(); i++){
+                    Lit l = symmetry_units[i];
+                    if (value(l) == l_False){
+                        symmetry_units.clear();
+                        return l_False;
+                    }else if (value(l) == l_Undef)
+                        uncheckedEnqueue(l);
+                }
+                symmetry_units.clear();
+                continue;
+            }
+
             // Simplify the set of problem clauses:
             if (decisionLevel() == 0 && !simplify())
                 return l_False;
@@ -766,18 +787,25 @@ lbool Solver::solve_()
     if (!ok) return l_False;
 
     // Set symmetry order
+    hooks.setController(symmetry.get());
     if (symmetry != nullptr) {
-        symmetry->enableCosy(cosy::OrderMode::AUTO,
-                             cosy::ValueMode::TRUE_LESS_FALSE);
+        symmetry->enableCosy(cosy_options);
         symmetry->printInfo();
 
+        // Only the symmetries stabilizing the assumptions are used
+        std::vector<Lit> assumps;
+        for (int i = 0; i < assumptions.size(); i++)
+            assumps.push_back(assumptions[i]);
+        symmetry->beginSolve(assumps);
+
         cosy::ClauseInjector::Type type = cosy::ClauseInjector::UNITS;
 	while (symmetry->hasClauseToInject(type)) {
 
             std::vector<Lit> literals = symmetry->clauseToInject(type);
             assert(literals.size() == 1);
             Lit l = literals[0];
-	    uncheckedEnqueue(l);
+            if (value(l) == l_Undef)
+                uncheckedEnqueue(l);
 	}
     }
     solves++;
@@ -948,19 +976,65 @@ void Solver::garbageCollect()
     to.moveTo(ca);
 }
 
-void Solver::learntSymmetryClause(cosy::ClauseInjector::Type type, Lit p) {
-    if (symmetry != nullptr) {
-        if (symmetry->hasClauseToInject(type, p)) {
-            std::vector<Lit> vsbp = symmetry->clauseToInject(type, p);
+// Attach the clauses given by cosy because of p and enqueue those that are
+// unit. Return the first conflicting one.
+CRef Solver::injectSymmetryClauses(Lit p)
+{
+    CRef confl = CRef_Undef;
+    CRef late  = CRef_Undef;     // Falsified below the current level
 
-            // Dirty make a copy of vector
-            vec<Lit> sbp;
-            for (Lit l : vsbp) {
-                sbp.push(l);
-            }
-            CRef cr = ca.alloc(sbp, true);
-            learnts.push(cr);
-            attachClause(cr);
+    if (!hooks.pendingClauses(p, &inject_pending))
+        return CRef_Undef;
+
+    for (const cosy::SolverHooks<Lit>::PendingClause& pending : inject_pending){
+        vec<Lit> sbp;
+        for (Lit l : pending.literals)
+            sbp.push(l);
+
+        // A DYNAMIC order gives units during search, see search()
+        if (sbp.size() == 1){
+            symmetry_units.push(sbp[0]);
+            continue;
+        }
+
+        // Watch the literals that are not false, or falsified last
+        for (int k = 0; k < 2 && k < sbp.size(); k++){
+            int best = k;
+            for (int m = k + 1; m < sbp.size(); m++)
+                if (value(sbp[best]) == l_False &&
+                    (value(sbp[m]) != l_False || level(var(sbp[m])) > level(var(sbp[best]))))
+                    best = m;
+            Lit tmp = sbp[k]; sbp[k] = sbp[best]; sbp[best] = tmp;
+        }
+
+        CRef cr = ca.alloc(sbp, true);
+        learnts.push(cr);
+        attachClause(cr);
+
+        if (confl != CRef_Undef)
+            continue;
+        const Clause& c = ca[cr];
+        if (value(c[0]) == l_False){
+            if (level(var(c[0])) == decisionLevel())
+                confl = cr;
+            else if (late == CRef_Undef || level(var(c[0])) < level(var(ca[late][0])))
+                late = cr;
+        }else if (value(c[0]) == l_Undef && value(c[1]) == l_False)
+            uncheckedEnqueue(c[0], cr);
+    }
+
+    // Backjump so that the clause is unit at its second highest level, or
+    // conflicting at its highest one when both levels are the same
+    if (confl == CRef_Undef && late != CRef_Undef){
+        const Clause& c = ca[late];
+        int highest = level(var(c[0])), second = level(var(c[1]));
+        if (second < highest){
+            cancelUntil(second);
+            uncheckedEnqueue(c[0], late);
+        }else{
+            cancelUntil(highest);
+            confl = late;
         }
     }
+    return confl;
 }
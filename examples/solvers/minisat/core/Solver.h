@@ -29,6 +29,7 @@ OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWA
 #include "utils/Options.h"
 #include "core/SolverTypes.h"
 
+#include "cosy/SolverHooks.h"
 #include "cosy/SymmetryController.h"
 
 
@@ -74,7 +75,10 @@ public:
 
     // Symmetry
     std::unique_ptr<cosy::SymmetryController<Lit>> symmetry;
-    void learntSymmetryClause(cosy::ClauseInjector::Type type, Lit p);
+    cosy::CosyOptions cosy_options;                     // Applied by solve_()
+    cosy::SolverHooks<Lit> hooks;                       // Set by solve_()
+    CRef injectSymmetryClauses(Lit p);                  // Attach the clauses given for p, return a conflict
+    vec<Lit> symmetry_units;                            // Units injected during search, enqueued at level 0
 
     // Convenience versions of 'toDimacs()':
     void    toDimacs     (const char* file);
@@ -207,6 +211,7 @@ protected:
     vec<Lit>            analyze_stack;
     vec<Lit>            analyze_toclear;
     vec<Lit>            add_tmp;
+    std::vector<cosy::SolverHooks<Lit>::PendingClause> inject_pending;
 
     double              max_learnts;
     double              learntsize_adjust_confl;
@@ -0,0 +1,92 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_BIGUNSIGNED_H_
+#define INCLUDE_COSY_BIGUNSIGNED_H_
+
+#include <cstdio>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "cosy/IntegralTypes.h"
+
+namespace cosy {
+
+// Arbitrary size unsigned integer, only what is needed to multiply orbit
+// sizes into a group order. Limbs are stored in base 10^9, least
+// significant first, so printing does not need any division.
+class BigUnsigned {
+ public:
+    explicit BigUnsigned(uint64 value = 0) {
+        do {
+            _limbs.push_back(value % kBase);
+            value /= kBase;
+        } while (value != 0);
+    }
+    ~BigUnsigned() {}
+
+    // The factor is split in limbs, so that each product fits in 64 bits
+    BigUnsigned& operator*=(uint64 factor) {
+        std::vector<uint32> product(_limbs.size() + 3, 0);
+        for (size_t j = 0; factor != 0; j++, factor /= kBase) {
+            const uint64 digit = factor % kBase;
+            uint64 carry = 0;
+            for (size_t i = 0; i < _limbs.size(); i++) {
+                carry += product[i + j] + _limbs[i] * digit;
+                product[i + j] = carry % kBase;
+                carry /= kBase;
+            }
+            for (size_t k = j + _limbs.size(); carry != 0; k++) {
+                carry += product[k];
+                product[k] = carry % kBase;
+                carry /= kBase;
+            }
+        }
+        _limbs.swap(product);
+        normalize();
+        return *this;
+    }
+
+    bool operator==(const BigUnsigned& other) const {
+        return _limbs == other._limbs;
+    }
+    bool operator!=(const BigUnsigned& other) const {
+        return !(*this == other);
+    }
+
+    bool isZero() const { return _limbs.size() == 1 && _limbs[0] == 0; }
+
+    std::string toString() const {
+        char digits[16];
+        std::string result = std::to_string(_limbs.back());
+        for (int i = static_cast<int>(_limbs.size()) - 2; i >= 0; i--) {
+            snprintf(digits, sizeof(digits), "%09u", _limbs[i]);
+            result += digits;
+        }
+        return result;
+    }
+
+ private:
+    static const uint32 kBase = 1000000000;
+    std::vector<uint32> _limbs;
+
+    void normalize() {
+        while (_limbs.size() > 1 && _limbs.back() == 0)
+            _limbs.pop_back();
+    }
+};
+
+inline std::ostream& operator<<(std::ostream& os, const BigUnsigned& value) {
+    return os << value.toString();
+}
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_BIGUNSIGNED_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,40 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_BINARYREADER_H_
+#define INCLUDE_COSY_BINARYREADER_H_
+
+#include <string>
+
+#include "cosy/BinaryWriter.h"
+#include "cosy/SymmetryReader.h"
+
+namespace cosy {
+
+// Read generators written by BinaryWriter. The format is not textual so the
+// cycle scanning of SymmetryReader is replaced, but malformed generators are
+// dropped the same way.
+class BinaryReader : public SymmetryReader {
+ public:
+    BinaryReader() {}
+    ~BinaryReader() {}
+
+    bool load(const std::string& symmetry_filename, unsigned int num_vars,
+              Group *group) override;
+
+    std::string formatName() const override { return std::string("binary"); }
+
+ private:
+    // Return false when the file ends in the middle of the generator.
+    bool readGenerator(StreamBuffer *in, unsigned int num_vars, Group *group);
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_BINARYREADER_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
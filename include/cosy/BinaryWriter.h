@@ -0,0 +1,48 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_BINARYWRITER_H_
+#define INCLUDE_COSY_BINARYWRITER_H_
+
+#include <string>
+
+#include "cosy/SymmetryWriter.h"
+
+namespace cosy {
+
+// Compact binary format, every integer is a LEB128 varint:
+//
+//   magic "COSYPERM", version, num_vars, num_generators
+//   for each generator: num_cycles
+//     for each cycle: length, first literal index, then the zigzag encoded
+//                     difference between consecutive literal indexes
+//
+// Cycles of a generator usually move close literals so most elements fit in
+// a single byte. BinaryReader reads it back.
+static const char kBinarySymmetryMagic[8] =
+    {'C', 'O', 'S', 'Y', 'P', 'E', 'R', 'M'};
+static const uint64 kBinarySymmetryVersion = 1;
+
+class BinaryWriter : public SymmetryWriter {
+ public:
+    BinaryWriter() {}
+    ~BinaryWriter() {}
+
+    std::string formatName() const override { return std::string("binary"); }
+
+ protected:
+    void writeHeader(unsigned int num_vars, const Group& group,
+                     StreamWriter *out) override;
+    void writeGenerator(unsigned int num_vars, const Permutation& generator,
+                        bool last, StreamWriter *out) override;
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_BINARYWRITER_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,31 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_BLISSREADER_H_
+#define INCLUDE_COSY_BLISSREADER_H_
+
+#include <string>
+
+#include "cosy/SaucyReader.h"
+
+namespace cosy {
+
+// bliss generators, values are 1-based nodes of CNFGraph as for saucy:
+// Generator: (1,3)(4,6)
+class BlissReader : public SaucyReader {
+ public:
+    BlissReader() {}
+    ~BlissReader() {}
+
+    std::string formatName() const override { return std::string("bliss"); }
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_BLISSREADER_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,35 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_BREAKIDREADER_H_
+#define INCLUDE_COSY_BREAKIDREADER_H_
+
+#include <string>
+
+#include "cosy/SymmetryReader.h"
+
+namespace cosy {
+
+// BreakID generators, values are DIMACS literals:
+// ( 1 -2 ) ( -1 2 )
+class BreakIDReader : public SymmetryReader {
+ public:
+    BreakIDReader() {}
+    ~BreakIDReader() {}
+
+    std::string formatName() const override { return std::string("breakid"); }
+
+ protected:
+    bool toSignedLiteral(int value, unsigned int num_vars,
+                         int *literal) const override;
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_BREAKIDREADER_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,35 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_BREAKIDWRITER_H_
+#define INCLUDE_COSY_BREAKIDWRITER_H_
+
+#include <string>
+
+#include "cosy/SymmetryWriter.h"
+
+namespace cosy {
+
+// Write one generator per line with DIMACS literals, as BreakID does:
+// ( 1 -2 ) ( -1 2 )
+class BreakIDWriter : public SymmetryWriter {
+ public:
+    BreakIDWriter() {}
+    ~BreakIDWriter() {}
+
+    std::string formatName() const override { return std::string("breakid"); }
+
+ protected:
+    void writeGenerator(unsigned int num_vars, const Permutation& generator,
+                        bool last, StreamWriter *out) override;
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_BREAKIDWRITER_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
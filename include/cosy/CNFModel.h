@@ -35,6 +35,12 @@ class CNFModel {
     int64 numberOfLargeClauses()   const { return _num_large_clauses;   }
 
     const std::vector<int64>& occurences() const { return _occurences; }
+    const std::vector<int64>& positiveOccurences() const {
+        return _positive_occurences;
+    }
+    const std::vector<int64>& negativeOccurences() const {
+        return _negative_occurences;
+    }
 
     void summarize() const;
 
@@ -48,16 +54,22 @@ class CNFModel {
     int64 _num_large_clauses;
 
     std::vector<std::unique_ptr<Clause>> _clauses;
+    // Tags of _clauses to skip duplicates, false when they are only
+    // computed by the next addClause() (see Snapshot::loadModel())
     std::unordered_set<size_t> _clauses_tag;
+    bool _has_tags;
 
     std::vector<int64> _positive_occurences;
     std::vector<int64> _negative_occurences;
     std::vector<int64> _occurences;
 
     size_t compute_tag(const std::vector<Literal>& literals);
+    void compute_tags();
     void compute_occurences(const std::vector<Literal>& literals);
     void compute_sizes(const std::vector<Literal>& literals);
 
+    friend class Snapshot;
+
     DISALLOW_COPY_AND_ASSIGN(CNFModel);
 };
 }  // namespace cosy
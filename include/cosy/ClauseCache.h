@@ -0,0 +1,80 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_CLAUSECACHE_H_
+#define INCLUDE_COSY_CLAUSECACHE_H_
+
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#include "cosy/IntegralTypes.h"
+#include "cosy/Literal.h"
+#include "cosy/Macros.h"
+#include "cosy/Stats.h"
+
+namespace cosy {
+
+// Bounded set of the last clauses given to the solver, with least recently
+// used eviction. Clauses are keyed by a hash of their sorted literals; on a
+// collision the older clause is evicted, the cache only has to avoid most
+// duplicates.
+class ClauseCache {
+ public:
+    explicit ClauseCache(unsigned int capacity);
+    ~ClauseCache() {}
+
+    // True when the clause is in the cache, which refreshes it.
+    bool contains(const std::vector<Literal>& literals);
+    void insert(const std::vector<Literal>& literals);
+    // Forget the clause, no-op when it is not in the cache.
+    void erase(const std::vector<Literal>& literals);
+
+    unsigned int size() const { return _entries.size(); }
+    unsigned int capacity() const { return _capacity; }
+    int64 numberOfHits() const { return _num_hits; }
+    int64 numberOfMisses() const { return _num_misses; }
+
+    void printStats() const { _stats.print(); }
+
+ private:
+    struct Entry {
+        uint64 hash;
+        std::vector<Literal> literals;
+    };
+
+    const unsigned int _capacity;
+    int64 _num_hits;
+    int64 _num_misses;
+
+    // Most recently used first
+    std::list<Entry> _entries;
+    std::unordered_map<uint64, std::list<Entry>::iterator> _index;
+    std::vector<Literal> _sorted;
+
+    uint64 sortAndHash(const std::vector<Literal>& literals);
+
+    struct Stats : public StatsGroup {
+        Stats() : StatsGroup("ESBP Cache"),
+                  hits("Number of duplicates skipped", this),
+                  misses("Number of new clauses", this),
+                  evictions("Number of evictions", this)
+        {}
+        CounterStat hits;
+        CounterStat misses;
+        CounterStat evictions;
+    };
+    Stats _stats;
+
+    DISALLOW_COPY_AND_ASSIGN(ClauseCache);
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_CLAUSECACHE_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
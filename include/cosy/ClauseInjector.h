@@ -4,12 +4,15 @@
 #define INCLUDE_COSY_CLAUSEINJECTOR_H_
 
 #include <deque>
+#include <memory>
 #include <unordered_set>
 #include <vector>
 #include <unordered_map>
 #include <utility>
 
 #include "cosy/Clause.h"
+#include "cosy/ClauseCache.h"
+#include "cosy/ClauseMinimizer.h"
 #include "cosy/Macros.h"
 #include "cosy/Literal.h"
 #include "cosy/Logging.h"
@@ -20,12 +23,18 @@ namespace cosy {
 
 class Injector {
  public:
-    Injector() {}
+    Injector() : _max_per_cause(1) {}
     ~Injector() {}
 
-    void addClause(BooleanVariable cause, std::vector<Literal>&& literals) {
-        if (cause == kNoBooleanVariable || _clauses[cause].empty())
-            _clauses[cause].push_back(std::move(literals));
+    // Number of clauses kept for a same cause, clauses without cause are
+    // never limited.
+    void setMaxClausesPerCause(unsigned int max) { _max_per_cause = max; }
+
+    void addClause(BooleanVariable cause, std::vector<Literal>&& literals,
+                   unsigned int lbd = 0) {
+        if (cause == kNoBooleanVariable ||
+            _clauses[cause].size() < _max_per_cause)
+            _clauses[cause].push_back(StoredClause(std::move(literals), lbd));
     }
 
     void removeClause(BooleanVariable cause) {
@@ -38,20 +47,33 @@ class Injector {
 
         return _clauses.at(cause).size() > 0;
     }
+    // LBD of the clause returned by the next getClause(), 0 when unknown.
+    unsigned int lbd(BooleanVariable cause) const {
+        CHECK_EQ(hasClause(cause), true);
+        return _clauses.at(cause).back().lbd;
+    }
     std::vector<Literal> getClause(BooleanVariable cause) {
         std::vector<Literal> literals;
 
         CHECK_EQ(hasClause(cause), true);
 
-        literals = std::move(_clauses[cause].back());
+        literals = std::move(_clauses[cause].back().literals);
         _clauses[cause].pop_back();
 
         return literals;
     }
 
  private:
+    struct StoredClause {
+        StoredClause(std::vector<Literal>&& l, unsigned int b) :
+            literals(std::move(l)), lbd(b) {}
+        std::vector<Literal> literals;
+        unsigned int lbd;
+    };
+
+    unsigned int _max_per_cause;
     std::unordered_map<BooleanVariable,
-                       std::vector<std::vector<Literal>>> _clauses;
+                       std::vector<StoredClause>> _clauses;
 };
 
 
@@ -61,6 +83,7 @@ class ClauseInjector {
         UNITS,
         ESBP,
         ESBP_FORCING,
+        SYMMETRIC_LEARNT,
         NR_TYPES
     };
 
@@ -73,23 +96,62 @@ class ClauseInjector {
     void removeClause(Type type, BooleanVariable cause);
     bool hasClause(Type type, BooleanVariable cause) const;
     std::vector<Literal> getClause(Type type, BooleanVariable cause);
+    unsigned int lbd(Type type, BooleanVariable cause) const {
+        return _injectors[type].lbd(cause);
+    }
 
     void removeClause(BooleanVariable cause);
 
-    void printStats() const { _stats.print(); }
+    // ESBP and forcing ESBP go through the minimizer, which also gives
+    // their LBD. Not owned.
+    void setClauseMinimizer(ClauseMinimizer *minimizer) {
+        _minimizer = minimizer;
+    }
+
+    // Remember the last capacity ESBP and forcing ESBP given to the solver
+    // and drop the new ones it already has, see ClauseCache. Clauses enter
+    // the cache when they are taken by getClause(), so that those removed
+    // on backtrack are not mistaken for clauses of the solver, and leave it
+    // when the solver reports their deletion with deletedClause().
+    void enableCache(unsigned int capacity) {
+        _cache = std::unique_ptr<ClauseCache>(new ClauseCache(capacity));
+    }
+    const ClauseCache* cache() const { return _cache.get(); }
+    void deletedClause(const std::vector<Literal>& literals) {
+        if (_cache)
+            _cache->erase(literals);
+    }
+
+    void setMaxClausesPerCause(Type type, unsigned int max) {
+        _injectors[type].setMaxClausesPerCause(max);
+    }
+
+    void printStats() const {
+        _stats.print();
+        if (_cache)
+            _cache->printStats();
+    }
 
  private:
     std::vector<Injector> _injectors;
+    ClauseMinimizer *_minimizer;
+    std::unique_ptr<ClauseCache> _cache;
+
+    static bool isESBP(Type type) {
+        return type == ESBP || type == ESBP_FORCING;
+    }
 
     struct Stats : StatsGroup {
         Stats() : StatsGroup("Clause Injector"),
                   units("Number of Units", this),
                   esbp("Number of ESBP", this),
-                  esbp_forcing("Number of ESBP Forcing", this) {}
+                  esbp_forcing("Number of ESBP Forcing", this),
+                  symmetric_learnt("Number of Symmetric Learnt", this) {}
 
         CounterStat units;
         CounterStat esbp;
         CounterStat esbp_forcing;
+        CounterStat symmetric_learnt;
     };
     Stats _stats;
 
@@ -0,0 +1,93 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_CLAUSEMINIMIZER_H_
+#define INCLUDE_COSY_CLAUSEMINIMIZER_H_
+
+#include <vector>
+
+#include "cosy/Assignment.h"
+#include "cosy/Literal.h"
+#include "cosy/Macros.h"
+#include "cosy/ReasonProvider.h"
+#include "cosy/Stats.h"
+
+namespace cosy {
+
+enum MinimizationMode {
+    NO_MINIMIZATION,
+    LEVEL_ZERO_MINIMIZATION,
+    REASON_MINIMIZATION,
+};
+
+// Shorten the ESBP before they reach the solver and compute their LBD.
+// A false literal can be removed when it is false at level 0 or, with
+// REASON_MINIMIZATION, when every other literal of its reason is in the
+// clause or false at level 0 (self-subsuming resolution, as the basic
+// learnt clause minimization of minisat). The two first literals are the
+// ones chosen to be watched and are always kept.
+//
+// Levels come from the decisions notified to the CosyManager, so the host
+// must notify them for the minimization and the LBD to be meaningful.
+class ClauseMinimizer {
+ public:
+    ClauseMinimizer(const Assignment& assignment,
+                    const std::vector<unsigned int>& levels);
+    ~ClauseMinimizer() {}
+
+    void setMode(MinimizationMode mode) { _mode = mode; }
+    MinimizationMode mode() const { return _mode; }
+    // Not owned, required by REASON_MINIMIZATION.
+    void setReasonProvider(ReasonProvider<Literal> *reasons) {
+        _reasons = reasons;
+    }
+
+    // Minimize the clause in place and return its LBD.
+    unsigned int minimize(std::vector<Literal> *literals);
+
+    // Number of distinct levels among the assigned literals.
+    unsigned int computeLBD(const std::vector<Literal>& literals);
+
+    void printStats() const { _stats.print(); }
+
+ private:
+    const Assignment& _assignment;
+    const std::vector<unsigned int>& _levels;
+    MinimizationMode _mode;
+    ReasonProvider<Literal> *_reasons;
+
+    std::vector<bool> _in_clause;
+    std::vector<bool> _redundant;
+    std::vector<Literal> _reason;
+    std::vector<unsigned int> _clause_levels;
+
+    bool isFalseAtLevelZero(Literal literal) const {
+        return _assignment.literalIsFalse(literal) &&
+            _levels[literal.variable().value()] == 0;
+    }
+    bool isRedundant(Literal literal);
+
+    struct Stats : public StatsGroup {
+        Stats() : StatsGroup("ESBP Minimization"),
+                  clauses("Number of minimized clauses", this),
+                  level_zero("Literals removed at level 0", this),
+                  reasons("Literals removed by reasons", this)
+        {}
+        CounterStat clauses;
+        CounterStat level_zero;
+        CounterStat reasons;
+    };
+    Stats _stats;
+
+    DISALLOW_COPY_AND_ASSIGN(ClauseMinimizer);
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_CLAUSEMINIMIZER_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
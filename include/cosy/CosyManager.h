@@ -7,43 +7,238 @@
 #include <vector>
 
 #include "cosy/Assignment.h"
+#include "cosy/ClauseMinimizer.h"
 #include "cosy/CosyStatus.h"
 #include "cosy/Group.h"
 #include "cosy/Logging.h"
 #include "cosy/Order.h"
+#include "cosy/Permutation.h"
+#include "cosy/RowOrdering.h"
+#include "cosy/SymmetryPropagator.h"
 
 namespace cosy {
 
+// How reducer statuses are chosen when several ESBP may be generated for a
+// same literal.
+enum ESBPSelection {
+    SHORTEST_ESBP,
+    LOWEST_LEVEL_ESBP,
+};
+
 class CosyManager {
  public:
     CosyManager(const Group& group, const Assignment& assignment);
     ~CosyManager();
 
-    void defineOrder(std::unique_ptr<Order>&& order);
+    // When max_stabilizer_statuses is not null, statuses are also created
+    // for coset representatives of a stabilizer chain built along the order,
+    // see addStabilizerStatuses(). When row_interchangeability is set,
+    // generators covered by an interchangeable matrix are replaced by the
+    // adjacent row swaps of a RowOrdering.
+    void defineOrder(std::unique_ptr<Order>&& order,
+                     unsigned int max_stabilizer_statuses = 0,
+                     bool row_interchangeability = false);
+    // Static order shared with other managers, see SymmetryData. It can
+    // not be a DynamicOrder.
+    void defineOrder(const std::shared_ptr<const Order>& order,
+                     unsigned int max_stabilizer_statuses = 0,
+                     bool row_interchangeability = false);
+
+    // Run a SymmetryPropagator next to the lex-leader statuses. It needs
+    // the decisions, so literals must be notified with is_decision.
+    void enableSymmetryPropagation();
+    bool symmetryPropagationEnabled() const { return _propagator != nullptr; }
+    SymmetryPropagator* propagator() const { return _propagator.get(); }
+
+    // Put to sleep the statuses that generated no ESBP during their last
+    // check_period updates. A sleeping status is detached from the watch
+    // lists for a number of restarts that doubles at each sleep, up to
+    // max_sleep, and is woken by restart().
+    void enableAdaptiveSleep(int64 check_period = 4096,
+                             unsigned int max_sleep = 1024);
+    // Must be called when the solver restarts at level 0.
+    void restart();
+    int64 numberOfSleepingStatuses() const { return _num_sleeping; }
+    bool isSleeping(int64 index) const {
+        return _activities[index].remaining > 0;
+    }
+
+    // Simplify the statuses with the level 0 literals at the restarts that
+    // follow new ones: a status settled by them (see CosyStatus::isSettled())
+    // is detached for good, the pairs they make equal are removed from the
+    // lookup order of the others. Level 0 literals must never be cancelled.
+    void enableLevelZeroSimplification();
+    int64 numberOfSettledStatuses() const { return _num_settled; }
+    bool isSettled(int64 index) const { return _settled[index]; }
+
+    // Incremental solving: the lex-leader constraint of a permutation is
+    // only sound under assumptions when the permutation maps the set of
+    // assumptions on itself. restrictTo() detaches the other statuses from
+    // the watch lists until a later call enables them again, the others
+    // keep their state. It must be called when the assignment only holds
+    // level 0 literals. canRestrictTo() is false when a status that would
+    // be detached already generated clauses: they may remove all the
+    // solutions under the new assumptions.
+    bool canRestrictTo(const std::vector<Literal>& assumptions);
+    void restrictTo(const std::vector<Literal>& assumptions);
+    bool isEnabled(int64 index) const { return !_disabled[index]; }
 
+    // By default only the first reducer status in the watch list generates
+    // an ESBP. With max > 1 all the statuses are notified and up to max
+    // reducers are selected, the injector must then keep as many ESBP per
+    // cause (see ClauseInjector::setMaxClausesPerCause()). The best ESBP
+    // is the first one returned by the injector.
+    void setMaxESBPPerLiteral(unsigned int max,
+                              ESBPSelection selection = SHORTEST_ESBP);
+
+    // Enable the ESBP of reducer and forcing statuses. When max_size is not
+    // null, statuses whose ESBP would have more than max_size literals are
+    // ignored: long clauses are costly and rarely useful.
+    void setESBPPolicy(bool esbp, bool forcing, unsigned int max_size = 0);
+
+    // Minimizer of the ESBP, working on the levels deduced from the
+    // notified decisions. It must be given to the ClauseInjector, see
+    // ClauseInjector::setClauseMinimizer().
+    ClauseMinimizer* minimizer() const { return _minimizer.get(); }
+
+    // Literal of variable to decide so that the first active status
+    // comparing it on its current pair does not become a reducer, see
+    // CosyStatus::suggestLiteral(). Return false when no status compares
+    // the variable.
+    bool suggestLiteral(BooleanVariable variable, Literal *literal);
+
+    // Units of the enabled statuses whose current pair is inverting.
     void generateUnits(ClauseInjector *injector);
-    void updateNotify(const Literal& literal, ClauseInjector *injector);
+    void updateNotify(const Literal& literal, ClauseInjector *injector) {
+        updateNotify(literal, false, injector);
+    }
+    void updateNotify(const Literal& literal, bool is_decision,
+                      ClauseInjector *injector);
     void updateCancel(const Literal& literal);
 
+    int64 numberOfStatuses() const { return _statuses.size(); }
+    int64 numberOfGeneratorStatuses() const {
+        return _num_generator_statuses;
+    }
+    int64 numberOfRowStatuses() const { return _num_row_statuses; }
+    int64 numberOfStabilizerStatuses() const {
+        return _statuses.size() - _num_generator_statuses - _num_row_statuses;
+    }
+    const CosyStatus& status(int64 index) const { return *_statuses[index]; }
+
     void summarize() const;
-    void printStats() const { _stats.print(); }
+    void printStats() const {
+        _stats.print();
+        if (_minimizer->mode() != NO_MINIMIZATION)
+            _minimizer->printStats();
+        if (_propagator)
+            _propagator->printStats();
+    }
 
  private:
     const Group& _group;
     const Assignment& _assignment;
-    std::unique_ptr<Order> _order;
+    std::shared_ptr<const Order> _order;
+    DynamicOrder *_dynamic_order;
+    std::unique_ptr<SymmetryPropagator> _propagator;
 
     std::vector< std::unique_ptr<CosyStatus> > _statuses;
 
+    // Statuses watching each variable, sorted by index. Statuses of the
+    // group generators come first, then row swaps and stabilizer chain.
+    std::vector< std::vector<unsigned int> > _watchers;
+    std::vector< std::unique_ptr<Permutation> > _stabilizer_permutations;
+    std::vector< std::unique_ptr<RowOrdering> > _row_orderings;
+    int64 _num_generator_statuses;
+    int64 _num_row_statuses;
+
+    bool _esbp;
+    bool _esbp_forcing;
+    unsigned int _max_esbp_size;
+
+    // Permutation of each status
+    std::vector<const Permutation*> _permutations;
+
+    struct Activity {
+        Activity() : checked_updates(0), checked_esbp(0), sleep_length(1),
+                     remaining(0) {}
+        int64 checked_updates;
+        int64 checked_esbp;
+        unsigned int sleep_length;
+        unsigned int remaining;  // restarts before waking up, 0 when awake
+    };
+    std::vector<Activity> _activities;
+    int64 _check_period;  // 0 when the adaptive sleep is disabled
+    unsigned int _max_sleep;
+    int64 _num_sleeping;
+    std::vector<unsigned int> _to_sleep;
+
+    // Level 0 simplification, the assignment holds _num_assigned literals
+    // and had _num_simplified of them at the last simplification
+    bool _level_zero_simplification;
+    int64 _num_assigned;
+    int64 _num_simplified;
+    int64 _num_settled;
+    std::vector<bool> _settled;
+
+    unsigned int _max_esbp_per_literal;
+    ESBPSelection _esbp_selection;
+    std::vector<unsigned int> _reducers;
+
+    // Decision levels deduced from the notified decisions
+    std::vector<unsigned int> _levels;
+    std::vector<BooleanVariable> _decisions;
+    std::unique_ptr<ClauseMinimizer> _minimizer;
+
+    // Statuses detached by restrictTo() and statuses that generated clauses
+    std::vector<bool> _disabled;
+    std::vector<bool> _gave_clauses;
+    std::vector<bool> _in_assumptions;
+
+    void addStatuses(unsigned int max_stabilizer_statuses,
+                     bool row_interchangeability);
+    void addStatus(const Permutation& permutation);
+    void extendOrder(BooleanVariable variable);
+    void addRowStatuses();
+    void addStabilizerStatuses(unsigned int max_statuses);
+    void watchStatus(unsigned int index, const Permutation& permutation);
+    void unwatchStatus(unsigned int index, const Permutation& permutation);
+    void checkActivity(unsigned int index);
+    bool acceptESBP(const CosyStatus& status);
+    void generateESBP(unsigned int index, BooleanVariable cause,
+                      ClauseInjector *injector);
+    void generateSelectedESBP(BooleanVariable cause,
+                              ClauseInjector *injector);
+    void wake(unsigned int index);
+    void simplify();
+    void attach(unsigned int index);
+    bool stabilizes(const Permutation& permutation,
+                    const std::vector<Literal>& assumptions) const;
+    void markAssumptions(const std::vector<Literal>& assumptions, bool value);
+
     struct Stats : public StatsGroup {
         Stats() : StatsGroup("Cosy Manager"),
                   total_time("Cosy total time", this),
                   notify_time(" |- notify time", this),
-                  cancel_time(" |- cancel time", this)
+                  cancel_time(" |- cancel time", this),
+                  generator_esbp("ESBP from generators", this),
+                  row_esbp("ESBP from row swaps", this),
+                  stabilizer_esbp("ESBP from stabilizer chain", this),
+                  skipped_esbp("ESBP skipped by size", this),
+                  sleeps("Number of status sleeps", this),
+                  settled("Number of settled statuses", this),
+                  suggestions("Number of suggested decisions", this)
         {}
         TimeDistribution total_time;
         TimeDistribution notify_time;
         TimeDistribution cancel_time;
+        CounterStat generator_esbp;
+        CounterStat row_esbp;
+        CounterStat stabilizer_esbp;
+        CounterStat skipped_esbp;
+        CounterStat sleeps;
+        CounterStat settled;
+        CounterStat suggestions;
     };
     Stats _stats;
 
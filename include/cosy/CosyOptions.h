@@ -0,0 +1,91 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_COSYOPTIONS_H_
+#define INCLUDE_COSY_COSYOPTIONS_H_
+
+#include <string>
+
+#include "cosy/ClauseMinimizer.h"
+#include "cosy/CosyManager.h"
+#include "cosy/IntegralTypes.h"
+#include "cosy/Order.h"
+#include "cosy/SymmetryFinder.h"
+
+namespace cosy {
+
+// Runtime configuration of the symmetry handling, set by the solver front
+// ends and applied by SymmetryController::enableCosy(). The defaults give
+// the historical behaviour: ESBP without forcing, AUTO order with
+// TRUE_LESS_FALSE values and bliss.
+struct CosyOptions {
+    CosyOptions() :
+        esbp(true),
+        esbp_forcing(false),
+        max_esbp_size(0),
+        order(AUTO),
+        value(TRUE_LESS_FALSE),
+        finder(SymmetryFinder::BLISS),
+        max_stabilizer_statuses(0),
+        max_symmetric_images(0),
+        sleep_check_period(0),
+        max_sleep(1024),
+        level_zero_simplification(false),
+        max_esbp_per_literal(1),
+        esbp_selection(SHORTEST_ESBP),
+        esbp_minimization(NO_MINIMIZATION),
+        esbp_cache_size(0),
+        row_interchangeability(false),
+        symmetry_propagation(false),
+        symmetric_learning(false),
+        symmetric_polarity(false) {}
+
+    // Lex-leader breaking
+    bool esbp;
+    bool esbp_forcing;
+    unsigned int max_esbp_size;          // 0 means unlimited
+    OrderMode order;
+    ValueMode value;
+
+    // Symmetry detection
+    SymmetryFinder::Automorphism finder;
+
+    // Budgets
+    unsigned int max_stabilizer_statuses;
+    unsigned int max_symmetric_images;   // per learnt clause, 0 means all
+    int64 sleep_check_period;            // 0 disables the adaptive sleep
+    unsigned int max_sleep;              // in restarts
+    bool level_zero_simplification;      // at restarts
+
+    // Injection policy
+    unsigned int max_esbp_per_literal;
+    ESBPSelection esbp_selection;
+    MinimizationMode esbp_minimization;  // reasons need a ReasonProvider
+    unsigned int esbp_cache_size;        // 0 disables the ESBP cache
+    bool row_interchangeability;
+    bool symmetry_propagation;           // both need esbp=0, they map
+    bool symmetric_learning;             // clauses by the symmetries
+    bool symmetric_polarity;             // decisions follow the lex order
+
+    // Read a comma separated list of name=value, e.g.
+    // "order=dynamic,esbp_forcing=1,max_esbp_per_literal=4". Names are the
+    // fields above, enumerations use their lower case names (see
+    // toString()). Return false on the first unknown name or bad value,
+    // the options are then left unchanged.
+    bool parse(const std::string& spec);
+    std::string toString() const;
+
+ private:
+    // Parse in place, stopping on the first error.
+    bool apply(const std::string& spec);
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_COSYOPTIONS_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -31,17 +31,54 @@ class CosyStatus {
     ~CosyStatus();
 
     void addLookupLiteral(const Literal& literal);
+    void clearLookupOrder();
+
+    // Restart the lookup from the first literal. Only valid when the
+    // assignment holds nothing but level 0 literals: the prefix they
+    // satisfy is never cancelled.
+    void reset();
+
+    // Level 0 simplification, with the same condition as reset() and level
+    // 0 literals that are never cancelled. isSettled() is true when the
+    // lookup stopped on a pair assigned to different values, or at its end:
+    // the state can not change any more. compactLookupOrder() removes the
+    // pairs assigned to the same value, they stay equal.
+    bool isSettled() const;
+    void compactLookupOrder();
+    unsigned int lookupSize() const { return _lookup_order.size(); }
 
     void updateNotify(const Literal& literal);
     void updateCancel(const Literal& literal);
 
     CosyState state() const { return _state; }
 
-    void generateUnitClauseOnInverting(ClauseInjector *injector);
+    // Number of compared pairs, the ESBP holds at most twice this number
+    // of literals.
+    unsigned int lookupIndex() const { return _lookup_index; }
+
+    // Literal of variable that can not make the current pair reducing when
+    // it is decided: the minimal element of the pair gets the minimal
+    // value, the maximal one gets the value of the minimal element, or the
+    // maximal value while it is unassigned. Return false when variable is
+    // not in the current pair of an active status.
+    bool suggestLiteral(BooleanVariable variable, Literal *literal) const;
+
+    // Highest level among the variables of the ESBP, given the level of
+    // each variable.
+    unsigned int esbpLevel(const std::vector<unsigned int>& levels) const;
+
+    // Return true when a unit is generated.
+    bool generateUnitClauseOnInverting(ClauseInjector *injector);
     void generateESBP(BooleanVariable reason, ClauseInjector *injector);
     void generateForceLexLeaderESBP(BooleanVariable reason,
                                     ClauseInjector *injector);
 
+    // Number of clauses generated, i.e. the pruning achieved by this status.
+    // ESBP are conflicting when generated and forcing ESBP are unit.
+    int64 numberOfESBP() const { return _num_esbp; }
+    int64 numberOfForcingESBP() const { return _num_forcing_esbp; }
+    int64 numberOfUpdates() const { return _num_updates; }
+
     std::string debugString() const;
 
  private:
@@ -61,6 +98,10 @@ class CosyStatus {
     std::deque<LookupInfo> _lookup_infos;
     CosyState _state;
 
+    int64 _num_esbp;
+    int64 _num_forcing_esbp;
+    int64 _num_updates;
+
     bool isLookupEnd() const { return _lookup_index >= _lookup_order.size(); }
     void updateState();
 
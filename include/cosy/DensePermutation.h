@@ -0,0 +1,86 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_DENSEPERMUTATION_H_
+#define INCLUDE_COSY_DENSEPERMUTATION_H_
+
+#include <vector>
+
+#include "cosy/Logging.h"
+
+namespace cosy {
+
+// Permutation of the points 0 .. size - 1 stored as an image array. Unlike
+// Permutation, composition and inversion are linear in the size of the
+// domain, so it is meant for small relabeled domains (see SchreierSims).
+class DensePermutation {
+ public:
+    DensePermutation() {}
+    explicit DensePermutation(unsigned int size) : _image(size) {
+        for (unsigned int i = 0; i < size; i++)
+            _image[i] = i;
+    }
+    ~DensePermutation() {}
+
+    unsigned int size() const { return _image.size(); }
+
+    int operator[](int point) const {
+        DCHECK_LT(point, static_cast<int>(_image.size()));
+        return _image[point];
+    }
+    void setImage(int point, int image) { _image[point] = image; }
+
+    bool isIdentity() const;
+
+    // Return the smallest moved point, -1 for the identity.
+    int firstMovedPoint() const;
+
+    // this = a o b, b is applied first.
+    void compose(const DensePermutation& a, const DensePermutation& b);
+    void invert(const DensePermutation& permutation);
+
+ private:
+    std::vector<int> _image;
+};
+
+inline bool DensePermutation::isIdentity() const {
+    return firstMovedPoint() < 0;
+}
+
+inline int DensePermutation::firstMovedPoint() const {
+    const int size = _image.size();
+    for (int i = 0; i < size; i++)
+        if (_image[i] != i)
+            return i;
+    return -1;
+}
+
+inline void DensePermutation::compose(const DensePermutation& a,
+                                      const DensePermutation& b) {
+    DCHECK_EQ(a.size(), b.size());
+    DCHECK(this != &a && this != &b);
+    const int size = b._image.size();
+
+    _image.resize(size);
+    for (int i = 0; i < size; i++)
+        _image[i] = a._image[b._image[i]];
+}
+
+inline void DensePermutation::invert(const DensePermutation& permutation) {
+    DCHECK(this != &permutation);
+    const int size = permutation._image.size();
+
+    _image.resize(size);
+    for (int i = 0; i < size; i++)
+        _image[permutation._image[i]] = i;
+}
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_DENSEPERMUTATION_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -3,106 +3,119 @@
 #ifndef INCLUDE_COSY_DISJOINTSETS_H_
 #define INCLUDE_COSY_DISJOINTSETS_H_
 
+#include <algorithm>
 #include <cassert>
-#include <vector>
-#include <memory>
 #include <iostream>
 #include <utility>
+#include <vector>
 
 
 namespace cosy {
 
+// Union-find over small integers stored in two flat arrays. Elements must be
+// added before use, absent elements have a negative parent. Union is by size
+// and Find uses path halving, so no recursion nor second pass is needed.
 class DisjointSets {
  public:
-        DisjointSets() : _num_elements(0), _num_sets(0) {}
-        virtual ~DisjointSets() {}
+    DisjointSets() : _num_elements(0), _num_sets(0) {}
+    explicit DisjointSets(unsigned int capacity) :
+        _num_elements(0), _num_sets(0) {
+        reserve(capacity);
+    }
+    virtual ~DisjointSets() {}
 
-        void Add(unsigned int element);
-        void Union(int set1, int set2);
-        int  Find(int element);
+    void Add(unsigned int element);
+    void Union(int set1, int set2);
+    int  Find(int element);
+
+    bool contains(unsigned int element) const {
+        return element < _parent.size() && _parent[element] >= 0;
+    }
+    int setSize(int element) { return _size[Find(element)]; }
 
-        unsigned int num_elements() const { return _num_elements; }
-        unsigned int num_sets() const { return _num_sets; }
+    unsigned int num_elements() const { return _num_elements; }
+    unsigned int num_sets() const { return _num_sets; }
+    unsigned int capacity() const { return _parent.size(); }
 
-        void debugPrint();
+    void reserve(unsigned int capacity);
+
+    // Remove all elements but keep the allocated memory, in time linear in
+    // the number of elements.
+    void clear();
+
+    void debugPrint();
 
  private:
-        struct Node {
-                explicit Node(unsigned int n) :
-                    parent(nullptr),
-                    index(n),
-                    rank(0) {}
-                Node *parent;
-                unsigned int index;
-                int rank;
-        };
-
-        std::vector< std::unique_ptr<Node> > _nodes;
-        unsigned int _num_elements;
-        unsigned int _num_sets;
+    std::vector<int> _parent;
+    std::vector<int> _size;
+    std::vector<int> _elements;
+    unsigned int _num_elements;
+    unsigned int _num_sets;
 };
 
+inline void DisjointSets::reserve(unsigned int capacity) {
+    if (capacity > _parent.size()) {
+        _parent.resize(capacity, -1);
+        _size.resize(capacity, 0);
+    }
+}
+
+inline void DisjointSets::clear() {
+    for (const int element : _elements) {
+        _parent[element] = -1;
+        _size[element] = 0;
+    }
+    _elements.clear();
+    _num_elements = 0;
+    _num_sets = 0;
+}
+
 inline void DisjointSets::Add(unsigned int element) {
-    if (element >= _nodes.size())
-        _nodes.resize(element + 1);
+    if (element >= _parent.size())
+        reserve(std::max<unsigned int>(element + 1, 2 * _parent.size()));
 
-    if (_nodes[element] == nullptr) {
-        _nodes[element] = std::move(std::unique_ptr<Node>(new Node(element)));
+    if (_parent[element] < 0) {
+        _parent[element] = element;
+        _size[element] = 1;
+        _elements.push_back(element);
         _num_elements++;
         _num_sets++;
     }
 }
 
 inline void DisjointSets::Union(int x, int y) {
-    assert(_nodes[x] != nullptr);
-    assert(_nodes[y] != nullptr);
+    assert(contains(x));
+    assert(contains(y));
 
-    Node *x_root = _nodes[Find(x)].get();
-    Node *y_root = _nodes[Find(y)].get();
-    int x_rank, y_rank;
+    int x_root = Find(x);
+    int y_root = Find(y);
 
     if (x_root == y_root)
         return;
 
-    x_rank = x_root->rank;
-    y_rank = y_root->rank;
-
-    if (x_rank < y_rank) {
-        x_root->parent = y_root;
-    } else if (x_rank > y_rank) {
-        y_root->parent = x_root;
-    } else { /* x_rank == y_rank */
-        y_root->parent = x_root;
-        x_root->rank += 1;
-    }
+    if (_size[x_root] < _size[y_root])
+        std::swap(x_root, y_root);
 
+    _parent[y_root] = x_root;
+    _size[x_root] += _size[y_root];
     _num_sets--;
 }
 
 inline int DisjointSets::Find(int element) {
-    Node *root = _nodes[element].get();
-    Node *set = nullptr, *parent = nullptr;
-
-    while (root->parent != nullptr) {
-        root = root->parent;
-    }
+    assert(contains(element));
 
-    /* Path compression */
-    set = _nodes[element].get();
-    while (set != root) {
-        parent = set->parent;
-        set->parent = root;
-        set = parent;
+    /* Path halving */
+    while (_parent[element] != element) {
+        _parent[element] = _parent[_parent[element]];
+        element = _parent[element];
     }
-
-    return root->index;
+    return element;
 }
 
 
 inline void DisjointSets::debugPrint() {
-    for (unsigned int i = 0; i < _nodes.size(); i++)
-        if (_nodes[i] != nullptr)
-            std::cout << i << " : " << Find(i) << std::endl;
+    for (const int element : _elements)
+        std::cout << element << " : " << Find(element) << std::endl;
 }
 
 }  // namespace cosy
@@ -0,0 +1,40 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_DREADNAUTREADER_H_
+#define INCLUDE_COSY_DREADNAUTREADER_H_
+
+#include <string>
+
+#include "cosy/SymmetryReader.h"
+
+namespace cosy {
+
+// dreadnaut generators, values are 0-based nodes of CNFGraph and long
+// generators are wrapped on indented lines:
+// (0 2)(3 5)(6 7 8 9
+//    10 11)
+class DreadnautReader : public SymmetryReader {
+ public:
+    DreadnautReader() {}
+    ~DreadnautReader() {}
+
+    std::string formatName() const override {
+        return std::string("dreadnaut");
+    }
+
+ protected:
+    bool toSignedLiteral(int value, unsigned int num_vars,
+                         int *literal) const override;
+    bool hasContinuationLines() const override { return true; }
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_DREADNAUTREADER_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
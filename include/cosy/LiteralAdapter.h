@@ -20,6 +20,7 @@ class LiteralAdapter {
 
 template<>
 class LiteralAdapter<cosy::Literal> {
+ public:
     virtual cosy::Literal convertFrom(cosy::Literal l) {
         return l;
     }
@@ -4,8 +4,6 @@
 #define INCLUDE_COSY_ORBITS_H_
 
 #include <vector>
-#include <unordered_set>
-#include <unordered_map>
 
 #include "cosy/DisjointSets.h"
 #include "cosy/Literal.h"
@@ -13,28 +11,83 @@
 
 namespace cosy {
 
+// Orbits of the variables moved by a set of permutations. Orbits are stored
+// in CSR form: the members of orbit i are _members[_offsets[i]] up to
+// _members[_offsets[i + 1]]. Orbits are sorted by representative, which is
+// the smallest variable of the orbit, and members are sorted increasingly,
+// so the result does not depend on the order of the permutations.
 class Orbits {
  public:
+    struct Orbit;
+    struct Iterator;
+
     Orbits() {}
     ~Orbits() {}
 
-    void assign(const std::vector<Permutation*> permutations);
+    void assign(const std::vector<Permutation*>& permutations);
 
-    const std::vector< std::vector<BooleanVariable> >::const_iterator begin() {
-        return _orbits.begin();
-    }
-    const std::vector< std::vector<BooleanVariable> >::const_iterator end() {
-        return _orbits.end();
+    Orbit orbit(int64 i) const;
+    BooleanVariable representative(int64 i) const {
+        return _members[_offsets[i]];
     }
 
-    // const std::vector< std::vector<BooleanVariable> > orbits() const;
+    Iterator begin() const;
+    Iterator end() const;
+
+    const std::vector<int>& offsets() const { return _offsets; }
+    const std::vector<BooleanVariable>& members() const { return _members; }
+
+    int64 numberOfOrbits() const {
+        return _offsets.empty() ? 0 : _offsets.size() - 1;
+    }
 
-    int64 numberOfOrbits() const { return _orbits.size(); }
  private:
+    DisjointSets _sets;
+    std::vector<int> _orbit_of_root;
+    std::vector<int> _fill;
+    std::vector<int> _offsets;
+    std::vector<BooleanVariable> _members;
     std::vector<BooleanVariable> _symmetrics;
-    std::vector< std::vector<BooleanVariable> > _orbits;
 };
 
+struct Orbits::Orbit {
+    typedef BooleanVariable value_type;
+    typedef std::vector<BooleanVariable>::const_iterator const_iterator;
+
+    Orbit(const_iterator b, const_iterator e) : _begin(b), _end(e) {}
+
+    const_iterator begin() const { return _begin; }
+    const_iterator end() const { return _end; }
+    unsigned int size() const { return _end - _begin; }
+
+    const const_iterator _begin;
+    const const_iterator _end;
+};
+
+struct Orbits::Iterator {
+    Iterator(const Orbits *orbits, int64 i) : _orbits(orbits), _i(i) {}
+
+    Orbit operator*() const { return _orbits->orbit(_i); }
+    Iterator& operator++() { ++_i; return *this; }
+    bool operator!=(const Iterator& other) const { return _i != other._i; }
+
+    const Orbits *_orbits;
+    int64 _i;
+};
+
+inline Orbits::Orbit Orbits::orbit(int64 i) const {
+    return Orbit(_members.begin() + _offsets[i],
+                 _members.begin() + _offsets[i + 1]);
+}
+
+inline Orbits::Iterator Orbits::begin() const {
+    return Iterator(this, 0);
+}
+
+inline Orbits::Iterator Orbits::end() const {
+    return Iterator(this, numberOfOrbits());
+}
+
 }  // namespace cosy
 #endif  // INCLUDE_COSY_ORBITS_H_
 /*
@@ -25,6 +25,7 @@ enum OrderMode {
     OCCURENCE,
     BREAKID,
     AUTO,
+    DYNAMIC,
 };
 
 enum ValueMode {
@@ -47,6 +48,11 @@ class Order {
     bool isMaximalValue(const Literal& literal,
                         const Assignment& assignment) const;
 
+    // Literal to set true so that the given literal gets the minimal value
+    Literal minimalValueLiteral(const Literal& literal) const {
+        return _valueMode == TRUE_LESS_FALSE ? literal : literal.negated();
+    }
+
     std::vector<Literal>::const_iterator begin() const {
         return _order.begin();
     }
@@ -117,81 +123,69 @@ class OccurenceOrder : public Order {
  private:
 };
 /*----------------------------------------------------------------------------*/
+// Greedy order of BreakID: repeatedly pick, in the largest orbit of the
+// remaining generators, the variable moved by the fewest of them, then drop
+// the generators that move it. Orbits, occurences and the best variable of
+// each orbit are maintained incrementally: removing generators only
+// recomputes the orbits they touched.
 class BreakIDOrder : public Order {
  public:
     explicit BreakIDOrder(int64 num_vars, ValueMode mode,
-                            const Group& group) :
-        Order(num_vars, mode) {
-        std::vector<Permutation*> Q, filter;
-        std::unordered_map<BooleanVariable, int64> occurence_generators;
-        Orbits orbits;
-        unsigned int largestOrbit;
-        BooleanVariable next;
-
-        for (const std::unique_ptr<Permutation>& perm : group.permutations())
-            Q.push_back(perm.get());
-
-        while (Q.size() > 0) {
-            // Compute occurence in remain generators
-            occurence_generators.clear();
-            for (const Permutation* permutation : Q) {
-                for (const Literal& literal : permutation->support())
-                    if (literal.isPositive())
-                        occurence_generators[literal.variable()]++;
-            }
-            occurence_generators[kNoBooleanVariable] =
-                std::numeric_limits<int>::max();
-
-            // Find next variable with less occurences in the largest orbit
-            orbits.assign(Q);
-
-            largestOrbit = 0;
-            next = kNoBooleanVariable;
-
-            for (const std::vector<BooleanVariable>& orbit : orbits) {
-                if (orbit.size() < largestOrbit)
-                    continue;
-                for (const BooleanVariable& variable : orbit) {
-                    if (occurence_generators[variable] == 0)
-                        continue;
-                    const int occ_v = occurence_generators[variable];
-                    const int occ_n = occurence_generators[next];
-                    if (next == kNoBooleanVariable ||
-                        occ_v < occ_n || (occ_v == occ_n && variable < next)) {
-                        next = variable;
-                        largestOrbit = orbit.size();
-                    }
-                }
-            }
-
-            if (next == kNoBooleanVariable) {
-                LOG(ERROR) << "Problem with generators ??";
-                break;
-            }
-
-            add(Literal(next, true));
-
-            // Remove permutation contains next
-            filter.clear();
-            const Literal next_literal = Literal(next, true);
-            for (Permutation* permutation : Q)
-                if (permutation->isTrivialImage(next_literal))
-                    filter.push_back(permutation);
-
-            Q = filter;
-        }
-
-        // Complete order
-        for (BooleanVariable var(0); var < num_vars; ++var) {
-            const Literal literal(var, true);
-            if (!contains(literal))
-                add(literal);
-        }
-    }
+                            const Group& group);
     ~BreakIDOrder() {}
     std::string variableModeString() const { return std::string("breakid"); }
 
  private:
+    struct OrbitSummary {
+        OrbitSummary() : best(kNoBooleanVariable) {}
+        std::vector<BooleanVariable> members;
+        BooleanVariable best;
+    };
+
+    // Remaining orbits indexed by representative, i.e. their smallest
+    // variable, so they are visited in the same order as Orbits outputs.
+    std::vector<OrbitSummary> _orbits;
+    std::vector<BooleanVariable> _orbit_of;
+    std::vector<int64> _occurences;
+
+    // Tournament tree over representatives holding the largest orbit size
+    // and the best variable of each subtree.
+    int64 _num_leaves;
+    std::vector<unsigned int> _tree_size;
+    std::vector<BooleanVariable> _tree_best;
+
+    void addOrbits(const Orbits& orbits);
+    void updateTree(BooleanVariable representative);
+    int64 findCandidate(int64 node, int64 first, int64 last, int64 from,
+                        unsigned int min_size, BooleanVariable champion) const;
+    BooleanVariable selectNext() const;
+
+    bool isBetter(BooleanVariable a, BooleanVariable b) const {
+        return _occurences[a.value()] < _occurences[b.value()] ||
+            (_occurences[a.value()] == _occurences[b.value()] && a < b);
+    }
+};
+
+/*----------------------------------------------------------------------------*/
+// Order built during search from the decision variables, in the order the
+// solver picks them. It starts empty and only grows, so clauses generated
+// on a prefix of the order stay valid for the final one. Variables that are
+// not ordered yet come after all ordered ones.
+class DynamicOrder : public Order {
+ public:
+    DynamicOrder(unsigned int num_vars, ValueMode mode) :
+        Order(num_vars, mode) {}
+
+    // Return false if the variable is already ordered.
+    bool append(BooleanVariable variable) {
+        const Literal literal(variable, true);
+        if (contains(literal))
+            return false;
+        add(literal);
+        return true;
+    }
+
+    std::string variableModeString() const { return std::string("dynamic"); }
 };
 
 }  // namespace cosy
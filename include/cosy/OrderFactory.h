@@ -36,6 +36,9 @@ inline Order* OrderFactory::create(OrderMode vars, ValueMode value,
         else
             order = new OccurenceOrder(num_vars, value, cnf_model);
         break;
+    case DYNAMIC:
+        order = new DynamicOrder(num_vars, value);
+        break;
     default:
         order = nullptr;
     }
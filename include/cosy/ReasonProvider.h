@@ -0,0 +1,34 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_REASONPROVIDER_H_
+#define INCLUDE_COSY_REASONPROVIDER_H_
+
+#include <vector>
+
+#include "cosy/Literal.h"
+
+namespace cosy {
+
+// Gives access to the implication reasons of the host solver, in its own
+// literal type like LiteralAdapter.
+template<class T>
+class ReasonProvider {
+ public:
+        ReasonProvider() {}
+        virtual ~ReasonProvider() {}
+
+        // Fill reason with the literals, other than literal, of the clause
+        // that propagated the true literal. Return false for decisions and
+        // literals without reason.
+        virtual bool reason(T literal, std::vector<T> *reason) = 0;
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_REASONPROVIDER_H_
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
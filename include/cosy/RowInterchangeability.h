@@ -0,0 +1,92 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_ROWINTERCHANGEABILITY_H_
+#define INCLUDE_COSY_ROWINTERCHANGEABILITY_H_
+
+#include <memory>
+#include <vector>
+
+#include "cosy/Group.h"
+#include "cosy/Literal.h"
+#include "cosy/Macros.h"
+#include "cosy/Permutation.h"
+
+namespace cosy {
+
+// Matrix of positive literals whose rows can be permuted in any way, the
+// symmetry acts the same way on negated literals.
+class LiteralMatrix {
+ public:
+    LiteralMatrix() {}
+    ~LiteralMatrix() {}
+
+    void addRow(std::vector<Literal>&& row) { _rows.push_back(row); }
+    void swapRows(unsigned int a, unsigned int b) {
+        std::swap(_rows[a], _rows[b]);
+    }
+
+    unsigned int numberOfRows() const { return _rows.size(); }
+    unsigned int numberOfColumns() const {
+        return _rows.empty() ? 0 : _rows[0].size();
+    }
+    const std::vector<Literal>& row(unsigned int i) const { return _rows[i]; }
+
+ private:
+    std::vector< std::vector<Literal> > _rows;
+
+    DISALLOW_COPY_AND_ASSIGN(LiteralMatrix);
+};
+
+// Detect row interchangeability in the generators of a Group, as BreakID
+// does. A candidate generator is an involution made of transpositions of
+// positive literals (and their negations). A matrix is started from one
+// candidate, its two rows being the sides of the transpositions, and grows
+// with every candidate swapping a row of the matrix with a new set of
+// variables. Candidates swapping two rows of a matrix are covered by it: the
+// transpositions used to build a matrix generate the symmetric group on its
+// rows.
+class RowInterchangeability {
+ public:
+    explicit RowInterchangeability(unsigned int num_vars);
+    ~RowInterchangeability() {}
+
+    void detect(const Group& group);
+
+    const std::vector< std::unique_ptr<LiteralMatrix> >& matrices() const {
+        return _matrices;
+    }
+    bool isCovered(int64 generator) const { return _covered[generator]; }
+    int64 numberOfCovered() const;
+
+ private:
+    const unsigned int _num_vars;
+    std::vector< std::unique_ptr<LiteralMatrix> > _matrices;
+    std::vector<bool> _covered;
+
+    // Position of each variable in the matrix being built
+    std::vector<int> _row_of;
+    std::vector<int> _column_of;
+
+    typedef std::vector< std::pair<Literal, Literal> > Transpositions;
+
+    bool isCandidate(const Permutation& permutation,
+                     Transpositions *transpositions) const;
+    bool swapsRows(const Transpositions& transpositions,
+                   const LiteralMatrix& matrix) const;
+    bool extendsMatrix(const Transpositions& transpositions,
+                       LiteralMatrix *matrix);
+    void placeRow(const LiteralMatrix& matrix, unsigned int row);
+
+    DISALLOW_COPY_AND_ASSIGN(RowInterchangeability);
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_ROWINTERCHANGEABILITY_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,47 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_ROWORDERING_H_
+#define INCLUDE_COSY_ROWORDERING_H_
+
+#include <memory>
+#include <vector>
+
+#include "cosy/Literal.h"
+#include "cosy/Macros.h"
+#include "cosy/Order.h"
+#include "cosy/Permutation.h"
+#include "cosy/RowInterchangeability.h"
+
+namespace cosy {
+
+// Lexicographic ordering of the rows of an interchangeable matrix. Rows are
+// sorted by their first literal in the order and one swap of adjacent rows
+// is kept for each pair: k - 1 permutations of the size of two rows replace
+// the k! elements of the symmetric group on rows. Each swap is a group
+// element, so a lex-leader status over it is sound whatever the order.
+class RowOrdering {
+ public:
+    RowOrdering(const LiteralMatrix& matrix, const Order& order,
+                unsigned int num_vars);
+    ~RowOrdering() {}
+
+    const std::vector< std::unique_ptr<Permutation> >& swaps() const {
+        return _swaps;
+    }
+
+ private:
+    std::vector< std::unique_ptr<Permutation> > _swaps;
+
+    DISALLOW_COPY_AND_ASSIGN(RowOrdering);
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_ROWORDERING_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
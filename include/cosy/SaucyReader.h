@@ -3,24 +3,28 @@
 #ifndef INCLUDE_COSY_SAUCYREADER_H_
 #define INCLUDE_COSY_SAUCYREADER_H_
 
-#include <memory>
 #include <string>
 
-#include "cosy/Group.h"
-#include "cosy/Permutation.h"
-#include "cosy/StreamBuffer.h"
+#include "cosy/SymmetryReader.h"
 
 namespace cosy {
 
-class SaucyReader {
+// saucy output, values are 1-based nodes of CNFGraph:
+// [
+// (1,3)(4,6),
+// (1,5)(2,4)
+// ]
+class SaucyReader : public SymmetryReader {
  public:
     SaucyReader() {}
     ~SaucyReader() {}
 
-    bool load(const std::string& symmetry_filename, unsigned int num_vars,
-              Group *group);
-};
+    std::string formatName() const override { return std::string("saucy"); }
 
+ protected:
+    bool toSignedLiteral(int value, unsigned int num_vars,
+                         int *literal) const override;
+};
 
 }  // namespace cosy
 
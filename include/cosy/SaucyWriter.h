@@ -0,0 +1,38 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_SAUCYWRITER_H_
+#define INCLUDE_COSY_SAUCYWRITER_H_
+
+#include <string>
+
+#include "cosy/SymmetryWriter.h"
+
+namespace cosy {
+
+// Write generators as saucy does, values are 1-based nodes of CNFGraph so
+// that the output can be read back by SaucyReader.
+class SaucyWriter : public SymmetryWriter {
+ public:
+    SaucyWriter() {}
+    ~SaucyWriter() {}
+
+    std::string formatName() const override { return std::string("saucy"); }
+
+ protected:
+    void writeHeader(unsigned int num_vars, const Group& group,
+                     StreamWriter *out) override;
+    void writeGenerator(unsigned int num_vars, const Permutation& generator,
+                        bool last, StreamWriter *out) override;
+    void writeFooter(StreamWriter *out) override;
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_SAUCYWRITER_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,138 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_SCHREIERSIMS_H_
+#define INCLUDE_COSY_SCHREIERSIMS_H_
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "cosy/BigUnsigned.h"
+#include "cosy/DensePermutation.h"
+#include "cosy/Group.h"
+#include "cosy/Literal.h"
+#include "cosy/Macros.h"
+#include "cosy/Permutation.h"
+
+namespace cosy {
+
+// Randomized Schreier-Sims algorithm computing a base and strong generating
+// set of a Group. The group acts on the literals it moves, which are
+// relabeled into a compact domain of points so that DensePermutation can be
+// used. Each level of the stabilizer chain stores its basic orbit as a
+// Schreier vector: the label of a point is the strong generator that maps
+// its parent in the orbit tree to it.
+//
+// Random elements are obtained by product replacement and sifted through
+// the chain; the computation stops when `confidence` consecutive elements
+// sift to the identity, so the result is correct with probability at least
+// 1 - 2^-confidence. When the budget is exhausted the chain is partial and
+// order() is only a lower bound of the group order.
+class SchreierSims {
+ public:
+    struct Budget {
+        Budget() :
+            max_sifts(100000),
+            max_elements(1 << 26),
+            confidence(20),
+            seed(2017) {}
+
+        // Number of random elements sifted through the chain.
+        int64 max_sifts;
+        // Number of integers stored by strong generators and Schreier
+        // vectors.
+        int64 max_elements;
+        int confidence;
+        unsigned int seed;
+    };
+
+    SchreierSims(const Group& group, unsigned int num_vars);
+    ~SchreierSims() {}
+
+    // Build the stabilizer chain. Base points are chosen in the order of
+    // `base_hint` when possible. Return false if the budget was exhausted.
+    bool compute(const std::vector<Literal>& base_hint, const Budget& budget);
+    bool compute() { return compute(std::vector<Literal>(), Budget()); }
+
+    bool isComplete() const { return _complete; }
+
+    unsigned int baseSize() const { return _base.size(); }
+    Literal basePoint(unsigned int level) const {
+        return _points[_base[level]];
+    }
+    std::vector<Literal> base() const;
+
+    int64 numberOfStrongGenerators() const { return _strong.size(); }
+    int64 numberOfPoints() const { return _points.size(); }
+
+    // Orbit of basePoint(level) under the pointwise stabilizer of the
+    // previous base points.
+    int64 basicOrbitSize(unsigned int level) const {
+        return _levels[level].orbit.size();
+    }
+    std::vector<Literal> basicOrbit(unsigned int level) const;
+    bool inBasicOrbit(unsigned int level, Literal literal) const;
+
+    // Product of the basic orbit sizes.
+    BigUnsigned order() const;
+
+    // Element u of the stabilizer of the previous base points such that
+    // u(basePoint(level)) == literal, nullptr if literal is not in the basic
+    // orbit.
+    std::unique_ptr<Permutation> cosetRepresentative(unsigned int level,
+                                                     Literal literal) const;
+    // Inverse of the above, it maps literal to basePoint(level).
+    std::unique_ptr<Permutation> inverseCosetRepresentative(
+        unsigned int level, Literal literal) const;
+
+    void summarize() const;
+
+ private:
+    struct Level {
+        std::vector<int> generators;  // indexes in _strong
+        std::vector<int> orbit;
+        std::vector<int> schreier;    // -1 outside orbit, -2 for the root
+    };
+
+    const unsigned int _num_vars;
+    std::vector<Literal> _points;
+    std::vector<int> _point_of;
+    std::vector<DensePermutation> _generators;
+
+    std::vector<int> _base;
+    std::vector<DensePermutation> _strong;
+    std::vector<DensePermutation> _strong_inverse;
+    std::vector<Level> _levels;
+    std::vector<int> _base_hint;
+    bool _complete;
+
+    std::mt19937 _rng;
+    std::vector<DensePermutation> _random_pool;
+    DensePermutation _random_element;
+    DensePermutation _scratch;
+
+    int64 numberOfElements() const;
+    int chooseBasePoint(const DensePermutation& permutation) const;
+    void addStrongGenerator(const DensePermutation& permutation, int level);
+    void computeOrbit(unsigned int level);
+    int sift(DensePermutation *permutation);
+    bool computeCosetRepresentative(unsigned int level, Literal literal,
+                                    DensePermutation *representative) const;
+    void initRandomElements();
+    const DensePermutation& nextRandomElement();
+    std::unique_ptr<Permutation> toPermutation(
+        const DensePermutation& permutation) const;
+
+    DISALLOW_COPY_AND_ASSIGN(SchreierSims);
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_SCHREIERSIMS_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,148 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_SNAPSHOT_H_
+#define INCLUDE_COSY_SNAPSHOT_H_
+
+#include <string>
+
+#include "cosy/CNFModel.h"
+#include "cosy/Group.h"
+#include "cosy/IntegralTypes.h"
+#include "cosy/Literal.h"
+#include "cosy/Logging.h"
+#include "cosy/Macros.h"
+
+namespace cosy {
+
+// A snapshot is a binary image of a CNFModel and its Group. The file starts
+// with a SnapshotHeader followed by 8 bytes aligned sections, so that it can
+// be mapped in memory and used in place:
+//
+//   clause offsets      int64[num_stored_clauses + 1]
+//   clause literals     int32[num_clause_literals]      (literal indexes)
+//   occurences          int64[3 * num_variables]        (positive, negative,
+//                                                         total)
+//   permutation offsets int64[num_permutations + 1]     (into cycle offsets)
+//   cycle offsets       int64[num_cycles + 1]           (into cycle literals)
+//   cycle literals      int32[num_cycle_literals]       (literal indexes)
+//
+// Integers are stored in the byte order of the writer.
+static const char kSnapshotMagic[8] = {'C', 'O', 'S', 'Y', 'S', 'N', 'A', 'P'};
+static const uint32 kSnapshotVersion = 1;
+
+struct SnapshotHeader {
+    char magic[8];
+    uint32 version;
+    uint32 header_size;
+
+    int64 num_variables;
+    int64 num_clauses;
+    int64 num_stored_clauses;
+    int64 num_clause_literals;
+    int64 num_permutations;
+    int64 num_cycles;
+    int64 num_cycle_literals;
+
+    int64 clause_offsets;
+    int64 clause_literals;
+    int64 occurences;
+    int64 permutation_offsets;
+    int64 cycle_offsets;
+    int64 cycle_literals;
+    int64 file_size;
+};
+
+class SnapshotWriter {
+ public:
+    SnapshotWriter() {}
+    ~SnapshotWriter() {}
+
+    bool write(const std::string& filename, const CNFModel& model,
+               const Group& group);
+
+ private:
+    DISALLOW_COPY_AND_ASSIGN(SnapshotWriter);
+};
+
+// Read-only view over a snapshot file. Clauses, occurences and cycles are
+// read directly from the mapped file and stay valid as long as the snapshot
+// is open.
+class Snapshot {
+ public:
+    Snapshot();
+    ~Snapshot();
+
+    bool open(const std::string& filename);
+    void close();
+    bool isOpen() const { return _header != nullptr; }
+
+    int64 numberOfVariables()    const { return _header->num_variables; }
+    int64 numberOfClauses()      const { return _header->num_stored_clauses; }
+    int64 numberOfPermutations() const { return _header->num_permutations; }
+
+    const Literal* clauseBegin(int64 clause) const {
+        DCHECK_LT(clause, numberOfClauses());
+        return _clause_literals + _clause_offsets[clause];
+    }
+    const Literal* clauseEnd(int64 clause) const {
+        DCHECK_LT(clause, numberOfClauses());
+        return _clause_literals + _clause_offsets[clause + 1];
+    }
+
+    const int64* positiveOccurences() const { return _occurences; }
+    const int64* negativeOccurences() const {
+        return _occurences + numberOfVariables();
+    }
+    const int64* occurences() const {
+        return _occurences + 2 * numberOfVariables();
+    }
+
+    int64 numberOfCycles(int64 permutation) const {
+        DCHECK_LT(permutation, numberOfPermutations());
+        return _permutation_offsets[permutation + 1] -
+            _permutation_offsets[permutation];
+    }
+    const Literal* cycleBegin(int64 permutation, int64 cycle) const {
+        return _cycle_literals +
+            _cycle_offsets[_permutation_offsets[permutation] + cycle];
+    }
+    const Literal* cycleEnd(int64 permutation, int64 cycle) const {
+        return _cycle_literals +
+            _cycle_offsets[_permutation_offsets[permutation] + cycle + 1];
+    }
+
+    // Build the regular in memory structures from the snapshot.
+    void loadModel(CNFModel *model) const;
+    void loadGroup(Group *group) const;
+
+ private:
+    void *_data;
+    int64 _size;
+
+    const SnapshotHeader *_header;
+    const int64 *_clause_offsets;
+    const Literal *_clause_literals;
+    const int64 *_occurences;
+    const int64 *_permutation_offsets;
+    const int64 *_cycle_offsets;
+    const Literal *_cycle_literals;
+
+    // The header must describe sections that fit in the file, checked
+    // before they are read.
+    bool checkHeader() const;
+    // Offsets and literals stored in the sections must stay in range.
+    bool checkSections() const;
+
+    DISALLOW_COPY_AND_ASSIGN(Snapshot);
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_SNAPSHOT_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
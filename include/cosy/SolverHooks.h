@@ -0,0 +1,129 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_SOLVERHOOKS_H_
+#define INCLUDE_COSY_SOLVERHOOKS_H_
+
+#include <vector>
+
+#include "cosy/ClauseInjector.h"
+#include "cosy/SymmetryController.h"
+
+namespace cosy {
+
+// The events a CDCL solver must give to cosy and the clauses it gets back,
+// in the terms of the solver. Every hook is a no-op while no controller is
+// set, so the solver calls them unconditionally:
+//  - onEnqueue() when a literal is assigned, with its decision level and
+//    whether it has no reason (decisions and assumptions),
+//  - onBacktrack() for every literal unassigned by a backtrack,
+//  - onRestart() after the solver restarted, with the level it went back
+//    to,
+//  - onDecide() with the literal the solver is about to decide, it returns
+//    the literal to decide instead,
+//  - onLearnt() after the backtrack of a conflict, before the learnt
+//    clause is enqueued,
+//  - onDelete() when a learnt clause is deleted,
+//  - pendingClauses() when a literal is propagated, to attach the clauses
+//    injected because of it.
+template<class T>
+class SolverHooks {
+ public:
+    struct PendingClause {
+        ClauseInjector::Type type;
+        std::vector<T> literals;
+        unsigned int lbd;  // 0 when unknown
+    };
+
+    SolverHooks() : _controller(nullptr) {}
+    ~SolverHooks() {}
+
+    // Not owned, nullptr disables the hooks.
+    void setController(SymmetryController<T> *controller) {
+        _controller = controller;
+    }
+    bool enabled() const { return _controller != nullptr; }
+
+    void onEnqueue(T literal, unsigned int level, bool is_decision) {
+        if (_controller)
+            _controller->updateNotify(literal, level, is_decision);
+    }
+    void onBacktrack(T literal) {
+        if (_controller)
+            _controller->updateCancel(literal);
+    }
+    void onRestart(unsigned int level) {
+        if (_controller && level == 0)
+            _controller->notifyRestart();
+    }
+    T onDecide(T literal) {
+        return _controller ? _controller->decisionLiteral(literal) : literal;
+    }
+    void onLearnt(const T* literals, size_t size) {
+        if (_controller)
+            _controller->learntClause(literals, size);
+    }
+    void onDelete(const T* literals, size_t size) {
+        if (_controller)
+            _controller->deletedClause(literals, size);
+    }
+
+    // Replace the content of clauses by the ESBP and forcing ESBP caused by
+    // literal, followed by the symmetric learnt clauses. ESBP are falsified
+    // by the assignment; the other clauses are unit or conflicting when
+    // they are queued, but the assignment may have grown since. Return
+    // false when there is no clause.
+    bool pendingClauses(T literal, std::vector<PendingClause> *clauses);
+
+ private:
+    SymmetryController<T> *_controller;
+
+    void take(ClauseInjector::Type type, T literal,
+              std::vector<PendingClause> *clauses);
+
+    DISALLOW_COPY_AND_ASSIGN(SolverHooks);
+};
+
+// Implementation
+
+template<class T> inline bool
+SolverHooks<T>::pendingClauses(T literal, std::vector<PendingClause> *clauses) {
+    const ClauseInjector::Type learnt = ClauseInjector::SYMMETRIC_LEARNT;
+
+    clauses->clear();
+    if (!_controller)
+        return false;
+
+    take(ClauseInjector::ESBP, literal, clauses);
+    take(ClauseInjector::ESBP_FORCING, literal, clauses);
+
+    while (_controller->hasClauseToInject(learnt)) {
+        clauses->emplace_back();
+        clauses->back().type = learnt;
+        clauses->back().literals = _controller->clauseToInject(learnt);
+        clauses->back().lbd = 0;
+    }
+
+    return !clauses->empty();
+}
+
+template<class T> inline void
+SolverHooks<T>::take(ClauseInjector::Type type, T literal,
+                     std::vector<PendingClause> *clauses) {
+    while (_controller->hasClauseToInject(type, literal)) {
+        clauses->emplace_back();
+        clauses->back().type = type;
+        clauses->back().literals =
+            _controller->clauseToInject(type, literal, &clauses->back().lbd);
+    }
+}
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_SOLVERHOOKS_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,82 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_STATICBREAKER_H_
+#define INCLUDE_COSY_STATICBREAKER_H_
+
+#include <string>
+#include <vector>
+
+#include "cosy/CNFModel.h"
+#include "cosy/Group.h"
+#include "cosy/IntegralTypes.h"
+#include "cosy/Literal.h"
+#include "cosy/Macros.h"
+#include "cosy/Order.h"
+#include "cosy/Permutation.h"
+
+namespace cosy {
+
+// Static symmetry breaking, as shatter or BreakID do: each generator g adds
+// the lex-leader constraint x <= g(x) to the formula, so any SAT solver can
+// use it without runtime hooks.
+//
+// The constraint follows the order over x1 .. xn and uses the chained
+// encoding with one auxiliary variable e_i per element, e_i being implied
+// by x1 .. xi = g(x1) .. g(xi):
+//
+//   e_{i-1} -> (xi <= g(xi))
+//   e_{i-1} & xi -> e_i
+//   e_{i-1} & !g(xi) -> e_i
+//
+// which is 3 clauses per element with false < true. The value mode
+// TRUE_LESS_FALSE negates both sides. Fixed points are skipped, the chain
+// stops after an inverting element (x = !x is impossible), and the second
+// element of a 2-cycle is skipped as it is equal when the first one is.
+class StaticBreaker {
+ public:
+    StaticBreaker(const Group& group, const Order& order,
+                  unsigned int num_vars);
+    ~StaticBreaker() {}
+
+    // Maximum number of elements of each chain, 0 means unlimited.
+    void setMaxLength(unsigned int max_length) { _max_length = max_length; }
+
+    void generate();
+
+    const std::vector< std::vector<Literal> >& clauses() const {
+        return _clauses;
+    }
+    unsigned int numberOfVariables() const { return _num_vars + _num_aux; }
+    unsigned int numberOfAuxiliaryVariables() const { return _num_aux; }
+
+    // Write the model followed by the symmetry breaking clauses in DIMACS.
+    bool write(const std::string& filename, const CNFModel& model) const;
+
+    void summarize() const;
+
+ private:
+    const Group& _group;
+    const Order& _order;
+    const unsigned int _num_vars;
+    unsigned int _max_length;
+    unsigned int _num_aux;
+
+    std::vector< std::vector<Literal> > _clauses;
+    std::vector<bool> _in_chain;
+
+    void addChain(const Permutation& permutation);
+    Literal newAuxiliary();
+
+    DISALLOW_COPY_AND_ASSIGN(StaticBreaker);
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_STATICBREAKER_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -24,6 +24,7 @@ class StreamBuffer {
     int readInt();
     void skipWhiteSpaces();
     void skipLine();
+    bool eof();
 
     int operator*();
     void operator++();
@@ -0,0 +1,65 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_STREAMWRITER_H_
+#define INCLUDE_COSY_STREAMWRITER_H_
+
+#include <cstdio>
+#include <string>
+
+#include "cosy/IntegralTypes.h"
+#include "cosy/Logging.h"
+#include "cosy/Macros.h"
+
+namespace cosy {
+
+// Buffered output counterpart of StreamBuffer. Integers are formatted by
+// hand and the buffer is only flushed when full, which is much faster than
+// iostreams on large outputs.
+class StreamWriter {
+ public:
+    explicit StreamWriter(const std::string& filename);
+    explicit StreamWriter(const char *filename);
+    ~StreamWriter();
+
+    bool good() const { return _out != nullptr && !_failed; }
+
+    void writeChar(char c) {
+        if (_size == kWriterBufferSize)
+            flush();
+        _buffer[_size++] = c;
+    }
+    void writeString(const char *string);
+    void writeString(const std::string& string) {
+        writeString(string.c_str());
+    }
+    void writeInt(int64 value);
+    void writeBytes(const void *data, int64 size);
+
+    // LEB128 variable length encoding, used by the binary formats.
+    void writeVarint(uint64 value);
+
+    bool flush();
+    bool close();
+
+ private:
+    static const int kWriterBufferSize = 1 << 16;
+
+    const std::string _filename;
+    FILE *_out;
+    bool _failed;
+    char _buffer[kWriterBufferSize];
+    int _size;
+
+    DISALLOW_COPY_AND_ASSIGN(StreamWriter);
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_STREAMWRITER_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
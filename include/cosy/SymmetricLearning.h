@@ -0,0 +1,82 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_SYMMETRICLEARNING_H_
+#define INCLUDE_COSY_SYMMETRICLEARNING_H_
+
+#include <vector>
+
+#include "cosy/Assignment.h"
+#include "cosy/ClauseInjector.h"
+#include "cosy/DensePermutation.h"
+#include "cosy/Group.h"
+#include "cosy/Literal.h"
+#include "cosy/Macros.h"
+#include "cosy/Stats.h"
+
+namespace cosy {
+
+// Symmetric explanation learning: the images of a learnt clause under the
+// group generators are also implied by the formula. Only the images that
+// are unit or conflicting under the current assignment are worth giving to
+// the solver, they are queued in the ClauseInjector as SYMMETRIC_LEARNT
+// clauses without cause. Generators are stored as DensePermutation over the
+// compact domain of moved literals, like in SchreierSims.
+class SymmetricLearning {
+ public:
+    SymmetricLearning(const Group& group, const Assignment& assignment);
+    ~SymmetricLearning() {}
+
+    // Maximum number of images computed for each learnt clause, 0 means
+    // all generators. Successive clauses start at different generators so
+    // that a small budget still covers the whole group.
+    void setBudget(unsigned int max_images) { _max_images = max_images; }
+
+    void learntClause(const std::vector<Literal>& clause,
+                      ClauseInjector *injector);
+
+    void summarize() const;
+    void printStats() const { _stats.print(); }
+
+ private:
+    const Assignment& _assignment;
+    unsigned int _max_images;
+    unsigned int _next_generator;
+
+    std::vector<Literal> _points;
+    std::vector<int> _point_of;
+    std::vector<DensePermutation> _generators;
+
+    std::vector<Literal> _image;
+    std::vector<bool> _in_clause;
+
+    // Return true if the image is unit or conflicting, the unassigned
+    // literal is moved first.
+    bool isUseful(std::vector<Literal> *image) const;
+
+    struct Stats : public StatsGroup {
+        Stats() : StatsGroup("Symmetric Learning"),
+                  learnt_time("Symmetric learning time", this),
+                  images("Number of images", this),
+                  units("Number of unit images", this),
+                  conflicts("Number of conflicting images", this)
+        {}
+        TimeDistribution learnt_time;
+        CounterStat images;
+        CounterStat units;
+        CounterStat conflicts;
+    };
+    Stats _stats;
+
+    DISALLOW_COPY_AND_ASSIGN(SymmetricLearning);
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_SYMMETRICLEARNING_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
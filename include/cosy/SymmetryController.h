@@ -9,6 +9,7 @@
 #include <string>
 
 #include "cosy/CosyManager.h"
+#include "cosy/CosyOptions.h"
 #include "cosy/ClauseInjector.h"
 #include "cosy/CNFModel.h"
 #include "cosy/CNFReader.h"
@@ -17,8 +18,12 @@
 #include "cosy/Logging.h"
 #include "cosy/OrderFactory.h"
 #include "cosy/Printer.h"
-#include "cosy/SaucyReader.h"
+#include "cosy/ReasonProvider.h"
+#include "cosy/Snapshot.h"
+#include "cosy/SymmetricLearning.h"
+#include "cosy/SymmetryData.h"
 #include "cosy/SymmetryFinder.h"
+#include "cosy/SymmetryReader.h"
 
 
 namespace cosy {
@@ -28,55 +33,198 @@ class SymmetryController {
  public:
     SymmetryController(const std::string& cnf_filename,
                        const std::string& symmetry_filename,
-                       const std::unique_ptr<LiteralAdapter<T>>& adapter);
+                       const std::unique_ptr<LiteralAdapter<T>>& adapter,
+                       SymmetryReader::Format format = SymmetryReader::SAUCY);
 
     SymmetryController(const std::string& cnf_filename,
                        SymmetryFinder::Automorphism tool,
                        const std::unique_ptr<LiteralAdapter<T>>& adapter);
 
+    SymmetryController(const std::string& snapshot_filename,
+                       const std::unique_ptr<LiteralAdapter<T>>& adapter);
+
+    // Build the model from the clauses of the host instead of reading the
+    // CNF file again: push every clause with addClause(), then call
+    // findSymmetries(). Literals must be over the num_vars first variables.
+    SymmetryController(unsigned int num_vars,
+                       const std::unique_ptr<LiteralAdapter<T>>& adapter);
+    void addClause(const T* literals_s, size_t size);
+    void findSymmetries(SymmetryFinder::Automorphism tool);
+
+    // Controller of another solver thread: the model, the group and the
+    // static order are shared with the controller that gave data, only the
+    // state of the search is owned.
+    SymmetryController(const std::shared_ptr<const SymmetryData>& data,
+                       const std::unique_ptr<LiteralAdapter<T>>& adapter);
+    // Data to build the controllers of other threads. It is read only from
+    // now on: no clause can be added and no symmetry found anymore. Call it
+    // after enableCosy() so that the order is also shared.
+    std::shared_ptr<const SymmetryData> sharedData();
+
     virtual ~SymmetryController() {}
 
-    void enableCosy(OrderMode vars, ValueMode value);
+    // The DYNAMIC order is built from the decisions, which are only known
+    // through the level overload of updateNotify(). Only the first call
+    // has an effect, so that an incremental host can call it before each
+    // solve.
+    void enableCosy(OrderMode vars, ValueMode value,
+                    unsigned int max_stabilizer_statuses = 0,
+                    bool row_interchangeability = false);
+    // Apply all the options but the finder, which is chosen when the
+    // controller is built.
+    void enableCosy(const CosyOptions& options);
+
+    // Shorten the ESBP before injection, see ClauseMinimizer. Reasons are
+    // only used by REASON_MINIMIZATION and must outlive the controller.
+    // Decisions must be notified with the level overload of updateNotify().
+    void setReasonProvider(ReasonProvider<T> *reasons);
+    void enableESBPMinimization(MinimizationMode mode);
+
+    // Do not give again an ESBP among the last capacity ones given, see
+    // ClauseInjector::enableCache(). The solver must then report the
+    // learnt clauses it deletes, so that a deleted ESBP can be given again.
+    void enableESBPCache(unsigned int capacity);
+    void deletedClause(const T* literals_s, size_t size);
+
+    // Inject the images of learnt clauses that are unit or conflicting,
+    // see SymmetricLearning. They are queued as SYMMETRIC_LEARNT clauses.
+    // A clause learnt from a lex-leader clause has images that are not
+    // implied by the formula, so no ESBP, forcing ESBP nor UNITS are given
+    // from then on.
+    void enableSymmetricLearning(unsigned int max_images_per_clause = 0);
+    void learntClause(const std::vector<T>& literals_s);
+    void learntClause(const T* literals_s, size_t size);
+
+    // Symmetry propagation, see SymmetryPropagator. It requires enableCosy()
+    // and decisions notified with the level overload of updateNotify(). A
+    // reason derived from a lex-leader clause has an image that is not
+    // implied by the formula, so no ESBP, forcing ESBP nor UNITS are given
+    // from then on. An implication that does not become a clause must be
+    // given back to discardSymmetricImplication().
+    void enableSymmetryPropagation();
+    bool hasSymmetricImplication() const;
+    T symmetricImplication();
+    T symmetricImplicationSource(T implied_s) const;
+    std::vector<T> symmetricImplicationReason(T implied_s,
+                                     const std::vector<T>& source_reason_s);
+    void discardSymmetricImplication(T implied_s);
+
+    // Statuses that do not prune are put to sleep until later restarts, see
+    // CosyManager::enableAdaptiveSleep(). notifyRestart() must then be
+    // called each time the solver restarts at level 0.
+    void enableAdaptiveSleep(int64 check_period = 4096,
+                             unsigned int max_sleep = 1024);
+    void notifyRestart();
+
+    // Detach the statuses settled by the level 0 literals and compact the
+    // others at restarts, see CosyManager::enableLevelZeroSimplification().
+    // It also needs notifyRestart().
+    void enableLevelZeroSimplification();
+
+    // Generate up to max ESBP per propagated literal, see
+    // CosyManager::setMaxESBPPerLiteral().
+    void setMaxESBPPerLiteral(unsigned int max,
+                              ESBPSelection selection = SHORTEST_ESBP);
+
+    // Let the lex order choose the polarity of the decisions, see
+    // CosyManager::suggestLiteral(). decisionLiteral() is called with the
+    // literal the solver would decide and returns the one to decide.
+    void enableSymmetricPolarity();
+    T decisionLiteral(T literal_s);
+
+    // Incremental solving: only the statuses whose permutation maps the
+    // set of assumptions on itself are used, see CosyManager::restrictTo().
+    // beginSolve() must be called at level 0 before each solve, then the
+    // UNITS must be injected again. canSolveUnder() is false when the
+    // clauses already given may be unsound under the assumptions, the
+    // host must then be rebuilt.
+    bool canSolveUnder(const std::vector<T>& assumptions_s);
+    void beginSolve(const std::vector<T>& assumptions_s);
 
     void updateNotify(T literal_s);
+    // Decisions at level 0 are treated as propagated literals.
+    void updateNotify(T literal_s, unsigned int level, bool is_decision);
     void updateCancel(T literal_s);
 
     bool hasClauseToInject(ClauseInjector::Type type, T literal_s) const;
     std::vector<T> clauseToInject(ClauseInjector::Type type, T literal_s);
+    // Also give the LBD computed for the clause, 0 when unknown.
+    std::vector<T> clauseToInject(ClauseInjector::Type type, T literal_s,
+                                  unsigned int *lbd);
 
     bool hasClauseToInject(ClauseInjector::Type type) const;
     std::vector<T> clauseToInject(ClauseInjector::Type type);
 
+    const Group& group() const { return _data->group(); }
+
     void printInfo() const;
     void printStats() const;
 
  private:
     unsigned int _num_vars;
     const std::unique_ptr<LiteralAdapter<T>>& _literal_adapter;
-    Group _group;
-    CNFModel _cnf_model;
+    std::shared_ptr<const SymmetryData> _data;
+    SymmetryData *_building;  // nullptr once the data is shared
     Assignment _assignment;
     ClauseInjector _injector;
     std::unique_ptr<CosyManager> _cosy_manager;
+    std::unique_ptr<SymmetricLearning> _symmetric_learning;
     std::unique_ptr<SymmetryFinder> _symmetry_finder;
-
+    bool _symmetric_polarity;
+
+    // Give the reasons of the host in cosy literals
+    class AdaptedReasonProvider : public ReasonProvider<Literal> {
+     public:
+        AdaptedReasonProvider(ReasonProvider<T> *reasons,
+                              const std::unique_ptr<LiteralAdapter<T>>& adapter)
+            : _reasons(reasons), _adapter(adapter) {}
+
+        bool reason(Literal literal, std::vector<Literal> *reason) override {
+            _reason_s.clear();
+            if (!_reasons->reason(_adapter->convertFrom(literal), &_reason_s))
+                return false;
+            for (const T& literal_s : _reason_s)
+                reason->push_back(_adapter->convertTo(literal_s));
+            return true;
+        }
+
+     private:
+        ReasonProvider<T> *_reasons;
+        const std::unique_ptr<LiteralAdapter<T>>& _adapter;
+        std::vector<T> _reason_s;
+    };
+    std::unique_ptr<AdaptedReasonProvider> _reasons;
+
+    void createData(unsigned int num_vars);
     bool loadCNFProblem(const std::string cnf_filename);
     std::vector<T> adaptVector(const std::vector<Literal>& literals);
+    std::vector<Literal> convertVector(const std::vector<T>& literals_s) const;
 };
 
 // Implementation
 
+template<class T> inline
+void SymmetryController<T>::createData(unsigned int num_vars) {
+    std::shared_ptr<SymmetryData> data(new SymmetryData(num_vars));
+
+    _building = data.get();
+    _data = std::move(data);
+    _num_vars = num_vars;
+    _assignment.resize(_num_vars);
+}
+
 template<class T> inline
 bool SymmetryController<T>::loadCNFProblem(const std::string cnf_filename) {
     CNFReader cnf_reader;
     bool success;
 
-    success = cnf_reader.load(cnf_filename, &_cnf_model);
+    success = cnf_reader.load(cnf_filename, _building->mutableModel());
     if (!success) {
         LOG(ERROR) << "CNF file " << cnf_filename << " is not well formed.";
         return false;
     }
-    _num_vars = _cnf_model.numberOfVariables();
+    _num_vars = _data->model().numberOfVariables();
+    _building->setNumberOfVariables(_num_vars);
     _assignment.resize(_num_vars);
 
     return true;
@@ -87,19 +235,28 @@ template<class T>
 inline SymmetryController<T>::SymmetryController(
                            const std::string& cnf_filename,
                            const std::string& sym_filename,
-                           const std::unique_ptr<LiteralAdapter<T>>& adapter) :
+                           const std::unique_ptr<LiteralAdapter<T>>& adapter,
+                           SymmetryReader::Format format) :
     _literal_adapter(adapter),
+    _building(nullptr),
     _cosy_manager(nullptr),
-    _symmetry_finder(nullptr) {
+    _symmetric_learning(nullptr),
+    _symmetry_finder(nullptr),
+    _symmetric_polarity(false) {
     bool success;
-    SaucyReader sym_reader;
 
+    createData(0);
     if (!loadCNFProblem(cnf_filename))
         return;
 
-    success = sym_reader.load(sym_filename, _num_vars, &_group);
+    std::unique_ptr<SymmetryReader> sym_reader(SymmetryReader::create(format));
+    CHECK_NOTNULL(sym_reader);
+
+    success = sym_reader->load(sym_filename, _num_vars,
+                               _building->mutableGroup());
     if (!success)
-        LOG(ERROR) << "Saucy file " << sym_filename << " is not well formed.";
+        LOG(ERROR) << sym_reader->formatName() << " file " << sym_filename
+                   << " is not well formed.";
 }
 
 template<class T>
@@ -108,32 +265,352 @@ inline SymmetryController<T>::SymmetryController(
                             SymmetryFinder::Automorphism tool,
                             const std::unique_ptr<LiteralAdapter<T>>& adapter) :
     _literal_adapter(adapter),
+    _building(nullptr),
     _cosy_manager(nullptr),
-    _symmetry_finder(nullptr) {
+    _symmetric_learning(nullptr),
+    _symmetry_finder(nullptr),
+    _symmetric_polarity(false) {
+    createData(0);
     if (!loadCNFProblem(cnf_filename))
         return;
 
     _symmetry_finder = std::unique_ptr<SymmetryFinder>
-        (SymmetryFinder::create(_cnf_model, tool));
+        (SymmetryFinder::create(_data->model(), tool));
 
     CHECK_NOTNULL(_symmetry_finder);
-    _symmetry_finder->findAutomorphism(&_group);
+    _symmetry_finder->findAutomorphism(_building->mutableGroup());
 }
 
 template<class T>
-inline void SymmetryController<T>::enableCosy(OrderMode vars, ValueMode value) {
-    if (_group.numberOfPermutations() == 0)
+inline SymmetryController<T>::SymmetryController(
+                            const std::string& snapshot_filename,
+                            const std::unique_ptr<LiteralAdapter<T>>& adapter) :
+    _literal_adapter(adapter),
+    _building(nullptr),
+    _cosy_manager(nullptr),
+    _symmetric_learning(nullptr),
+    _symmetry_finder(nullptr),
+    _symmetric_polarity(false) {
+    Snapshot snapshot;
+
+    createData(0);
+    if (!snapshot.open(snapshot_filename))
         return;
 
-    std::unique_ptr<Order> order
-        (OrderFactory::create(vars, value, _cnf_model, _group));
-    CHECK_NOTNULL(order);
+    snapshot.loadModel(_building->mutableModel());
+    snapshot.loadGroup(_building->mutableGroup());
+
+    _num_vars = _data->model().numberOfVariables();
+    _building->setNumberOfVariables(_num_vars);
+    _assignment.resize(_num_vars);
+}
+
+template<class T>
+inline SymmetryController<T>::SymmetryController(
+                            unsigned int num_vars,
+                            const std::unique_ptr<LiteralAdapter<T>>& adapter) :
+    _literal_adapter(adapter),
+    _building(nullptr),
+    _cosy_manager(nullptr),
+    _symmetric_learning(nullptr),
+    _symmetry_finder(nullptr),
+    _symmetric_polarity(false) {
+    createData(num_vars);
+}
+
+template<class T>
+inline SymmetryController<T>::SymmetryController(
+                            const std::shared_ptr<const SymmetryData>& data,
+                            const std::unique_ptr<LiteralAdapter<T>>& adapter) :
+    _num_vars(data->numberOfVariables()),
+    _literal_adapter(adapter),
+    _data(data),
+    _building(nullptr),
+    _cosy_manager(nullptr),
+    _symmetric_learning(nullptr),
+    _symmetry_finder(nullptr),
+    _symmetric_polarity(false) {
+    _assignment.resize(_num_vars);
+}
+
+template<class T> inline std::shared_ptr<const SymmetryData>
+SymmetryController<T>::sharedData() {
+    _building = nullptr;
+    return _data;
+}
+
+template<class T> inline void
+SymmetryController<T>::addClause(const T* literals_s, size_t size) {
+    std::vector<Literal> literals_c;
+
+    literals_c.reserve(size);
+    for (size_t i = 0; i < size; i++)
+        literals_c.push_back(_literal_adapter->convertTo(literals_s[i]));
+    CHECK_NOTNULL(_building);
+    _building->mutableModel()->addClause(&literals_c);
+}
+
+template<class T> inline void
+SymmetryController<T>::findSymmetries(SymmetryFinder::Automorphism tool) {
+    CHECK_NOTNULL(_building);
+    CHECK_LE(_data->model().numberOfVariables(),
+             static_cast<int64>(_num_vars));
+
+    _symmetry_finder = std::unique_ptr<SymmetryFinder>
+        (SymmetryFinder::create(_data->model(), tool));
+
+    CHECK_NOTNULL(_symmetry_finder);
+    _symmetry_finder->findAutomorphism(_building->mutableGroup());
+}
+
+template<class T>
+inline void SymmetryController<T>::enableCosy(OrderMode vars, ValueMode value,
+                                       unsigned int max_stabilizer_statuses,
+                                       bool row_interchangeability) {
+    if (_cosy_manager || group().numberOfPermutations() == 0)
+        return;
 
     _cosy_manager = std::unique_ptr<CosyManager>
-        (new CosyManager(_group, _assignment));
+        (new CosyManager(group(), _assignment));
+
+    // Static orders are kept with the data to be shared
+    if (_building)
+        _building->defineOrder(vars, value);
+    const std::shared_ptr<const Order> shared = _data->order(vars, value);
+    if (shared) {
+        _cosy_manager->defineOrder(shared, max_stabilizer_statuses,
+                                   row_interchangeability);
+    } else {
+        std::unique_ptr<Order> order
+            (OrderFactory::create(vars, value, _data->model(), group()));
+        CHECK_NOTNULL(order);
+        _cosy_manager->defineOrder(std::move(order), max_stabilizer_statuses,
+                                   row_interchangeability);
+    }
+    if (_reasons)
+        _cosy_manager->minimizer()->setReasonProvider(_reasons.get());
+    _injector.setClauseMinimizer(_cosy_manager->minimizer());
+    if (!_symmetric_learning && !_cosy_manager->symmetryPropagationEnabled())
+        _cosy_manager->generateUnits(&_injector);
+}
+
+template<class T>
+inline void SymmetryController<T>::enableCosy(const CosyOptions& options) {
+    if (_cosy_manager)
+        return;
+    enableCosy(options.order, options.value, options.max_stabilizer_statuses,
+               options.row_interchangeability);
+    if (!_cosy_manager)
+        return;
+
+    _cosy_manager->setESBPPolicy(options.esbp, options.esbp_forcing,
+                                 options.max_esbp_size);
+    setMaxESBPPerLiteral(options.max_esbp_per_literal, options.esbp_selection);
+    if (options.sleep_check_period > 0)
+        enableAdaptiveSleep(options.sleep_check_period, options.max_sleep);
+    if (options.level_zero_simplification)
+        enableLevelZeroSimplification();
+    enableESBPMinimization(options.esbp_minimization);
+    if (options.esbp_cache_size > 0)
+        enableESBPCache(options.esbp_cache_size);
+    if (options.symmetric_polarity)
+        enableSymmetricPolarity();
+
+    // Reasons and learnt clauses may be derived from lex-leader clauses,
+    // their images are then not implied by the formula
+    const bool lex_leader = options.esbp || options.esbp_forcing;
+    if (options.symmetry_propagation) {
+        if (lex_leader)
+            LOG(WARNING) << "Symmetry propagation is not compatible with ESBP";
+        else
+            enableSymmetryPropagation();
+    }
+    if (options.symmetric_learning) {
+        if (lex_leader)
+            LOG(WARNING) << "Symmetric learning is not compatible with ESBP";
+        else
+            enableSymmetricLearning(options.max_symmetric_images);
+    }
+}
+
+template<class T> inline void
+SymmetryController<T>::setReasonProvider(ReasonProvider<T> *reasons) {
+    _reasons = std::unique_ptr<AdaptedReasonProvider>
+        (new AdaptedReasonProvider(reasons, _literal_adapter));
+    if (_cosy_manager)
+        _cosy_manager->minimizer()->setReasonProvider(_reasons.get());
+}
+
+template<class T> inline void
+SymmetryController<T>::enableESBPMinimization(MinimizationMode mode) {
+    if (!_cosy_manager)
+        return;
+
+    if (mode == REASON_MINIMIZATION && !_reasons) {
+        LOG(WARNING) << "No reason provider, ESBP are only minimized at "
+                     << "level 0";
+        mode = LEVEL_ZERO_MINIMIZATION;
+    }
+    _cosy_manager->minimizer()->setMode(mode);
+}
+
+template<class T> inline void
+SymmetryController<T>::enableESBPCache(unsigned int capacity) {
+    _injector.enableCache(capacity);
+}
+
+template<class T> inline void
+SymmetryController<T>::deletedClause(const T* literals_s, size_t size) {
+    if (_injector.cache() == nullptr)
+        return;
 
-    _cosy_manager->defineOrder(std::move(order));
-    _cosy_manager->generateUnits(&_injector);
+    std::vector<Literal> literals_c;
+    literals_c.reserve(size);
+    for (size_t i = 0; i < size; i++)
+        literals_c.push_back(_literal_adapter->convertTo(literals_s[i]));
+    _injector.deletedClause(literals_c);
+}
+
+template<class T> inline void
+SymmetryController<T>::enableSymmetricLearning(unsigned int
+                                               max_images_per_clause) {
+    if (group().numberOfPermutations() == 0)
+        return;
+
+    _symmetric_learning = std::unique_ptr<SymmetricLearning>
+        (new SymmetricLearning(group(), _assignment));
+    _symmetric_learning->setBudget(max_images_per_clause);
+
+    _injector.removeClause(ClauseInjector::UNITS, kNoBooleanVariable);
+    if (_cosy_manager)
+        _cosy_manager->setESBPPolicy(false, false);
+}
+
+template<class T> inline void
+SymmetryController<T>::learntClause(const std::vector<T>& literals_s) {
+    learntClause(literals_s.data(), literals_s.size());
+}
+
+template<class T> inline void
+SymmetryController<T>::learntClause(const T* literals_s, size_t size) {
+    if (!_symmetric_learning)
+        return;
+
+    std::vector<Literal> literals_c;
+    literals_c.reserve(size);
+    for (size_t i = 0; i < size; i++)
+        literals_c.push_back(_literal_adapter->convertTo(literals_s[i]));
+    _symmetric_learning->learntClause(literals_c, &_injector);
+}
+
+template<class T>
+inline void SymmetryController<T>::enableSymmetryPropagation() {
+    if (!_cosy_manager) {
+        LOG(WARNING) << "Symmetry propagation needs cosy to be enabled";
+        return;
+    }
+    _cosy_manager->enableSymmetryPropagation();
+    _injector.removeClause(ClauseInjector::UNITS, kNoBooleanVariable);
+    _cosy_manager->setESBPPolicy(false, false);
+}
+
+template<class T>
+inline bool SymmetryController<T>::hasSymmetricImplication() const {
+    return _cosy_manager && _cosy_manager->symmetryPropagationEnabled() &&
+        _cosy_manager->propagator()->hasImplication();
+}
+
+template<class T>
+inline T SymmetryController<T>::symmetricImplication() {
+    const Literal implied_c = _cosy_manager->propagator()->nextImplication();
+    return _literal_adapter->convertFrom(implied_c);
+}
+
+template<class T>
+inline T SymmetryController<T>::symmetricImplicationSource(T implied_s) const {
+    const Literal implied_c = _literal_adapter->convertTo(implied_s);
+    const Literal source_c = _cosy_manager->propagator()->source(implied_c);
+    return _literal_adapter->convertFrom(source_c);
+}
+
+template<class T> inline std::vector<T>
+SymmetryController<T>::symmetricImplicationReason(T implied_s,
+                                   const std::vector<T>& source_reason_s) {
+    const Literal implied_c = _literal_adapter->convertTo(implied_s);
+    std::vector<Literal> source_reason_c;
+    for (const T& literal_s : source_reason_s)
+        source_reason_c.push_back(_literal_adapter->convertTo(literal_s));
+
+    return adaptVector(_cosy_manager->propagator()->reason(implied_c,
+                                                           source_reason_c));
+}
+
+template<class T>
+inline void SymmetryController<T>::discardSymmetricImplication(T implied_s) {
+    const Literal implied_c = _literal_adapter->convertTo(implied_s);
+    _cosy_manager->propagator()->discard(implied_c);
+}
+
+template<class T>
+inline void SymmetryController<T>::enableAdaptiveSleep(int64 check_period,
+                                                       unsigned int max_sleep) {
+    if (_cosy_manager)
+        _cosy_manager->enableAdaptiveSleep(check_period, max_sleep);
+}
+
+template<class T>
+inline void SymmetryController<T>::enableLevelZeroSimplification() {
+    if (_cosy_manager)
+        _cosy_manager->enableLevelZeroSimplification();
+}
+
+template<class T> inline void
+SymmetryController<T>::setMaxESBPPerLiteral(unsigned int max,
+                                            ESBPSelection selection) {
+    _injector.setMaxClausesPerCause(ClauseInjector::ESBP, max);
+    if (_cosy_manager)
+        _cosy_manager->setMaxESBPPerLiteral(max, selection);
+}
+
+template<class T>
+inline void SymmetryController<T>::notifyRestart() {
+    if (_cosy_manager)
+        _cosy_manager->restart();
+}
+
+template<class T>
+inline void SymmetryController<T>::enableSymmetricPolarity() {
+    _symmetric_polarity = _cosy_manager != nullptr;
+}
+
+template<class T>
+inline T SymmetryController<T>::decisionLiteral(T literal_s) {
+    if (!_symmetric_polarity)
+        return literal_s;
+
+    const Literal literal_c = _literal_adapter->convertTo(literal_s);
+    Literal suggested_c;
+    if (!_cosy_manager->suggestLiteral(literal_c.variable(), &suggested_c) ||
+        suggested_c == literal_c)
+        return literal_s;
+    return _literal_adapter->convertFrom(suggested_c);
+}
+
+template<class T> inline bool
+SymmetryController<T>::canSolveUnder(const std::vector<T>& assumptions_s) {
+    return !_cosy_manager ||
+        _cosy_manager->canRestrictTo(convertVector(assumptions_s));
+}
+
+template<class T> inline void
+SymmetryController<T>::beginSolve(const std::vector<T>& assumptions_s) {
+    if (!_cosy_manager)
+        return;
+
+    _cosy_manager->restrictTo(convertVector(assumptions_s));
+    _injector.removeClause(ClauseInjector::UNITS, kNoBooleanVariable);
+    if (!_symmetric_learning && !_cosy_manager->symmetryPropagationEnabled())
+        _cosy_manager->generateUnits(&_injector);
 }
 
 template<class T>
@@ -144,6 +621,17 @@ inline void SymmetryController<T>::updateNotify(T literal_s) {
         _cosy_manager->updateNotify(literal_c, &_injector);
 }
 
+template<class T>
+inline void SymmetryController<T>::updateNotify(T literal_s,
+                                                unsigned int level,
+                                                bool is_decision) {
+    cosy::Literal literal_c = _literal_adapter->convertTo(literal_s);
+    _assignment.assignFromTrueLiteral(literal_c);
+    if (_cosy_manager)
+        _cosy_manager->updateNotify(literal_c, is_decision && level > 0,
+                                    &_injector);
+}
+
 template<class T>
 inline void SymmetryController<T>::updateCancel(T literal_s) {
     cosy::Literal literal_c = _literal_adapter->convertTo(literal_s);
@@ -173,6 +661,14 @@ SymmetryController<T>::clauseToInject(ClauseInjector::Type type, T literal_s) {
     return literals_s;
 }
 
+template<class T> inline std::vector<T>
+SymmetryController<T>::clauseToInject(ClauseInjector::Type type, T literal_s,
+                                      unsigned int *lbd) {
+    cosy::Literal literal_c =  _literal_adapter->convertTo(literal_s);
+    *lbd = _injector.lbd(type, literal_c.variable());
+    return clauseToInject(type, literal_s);
+}
+
 template<class T> inline bool
 SymmetryController<T>::hasClauseToInject(ClauseInjector::Type type) const {
     return _injector.hasClause(type, kNoBooleanVariable);
@@ -196,6 +692,15 @@ SymmetryController<T>::adaptVector(const std::vector<Literal>& literals) {
     return std::move(adapted);
 }
 
+template<class T> inline std::vector<Literal>
+SymmetryController<T>::convertVector(const std::vector<T>& literals_s) const {
+    std::vector<Literal> converted;
+    for (const T& literal_s : literals_s)
+        converted.push_back(_literal_adapter->convertTo(literal_s));
+
+    return converted;
+}
+
 template<class T> inline void
 SymmetryController<T>::printStats() const {
     Printer::printSection(" Symmetry Stats ");
@@ -203,17 +708,22 @@ SymmetryController<T>::printStats() const {
     if (_cosy_manager) {
         IF_STATS_ENABLED(_cosy_manager->printStats());
     }
+    if (_symmetric_learning) {
+        IF_STATS_ENABLED(_symmetric_learning->printStats());
+    }
 }
 
 template<class T> inline void
 SymmetryController<T>::printInfo() const {
-    _cnf_model.summarize();
+    _data->model().summarize();
     Printer::printSection(" Symmetry Information ");
     if (_symmetry_finder)
         _symmetry_finder->printStats();
-    _group.summarize(_num_vars);
+    group().summarize(_num_vars);
     if (_cosy_manager)
         _cosy_manager->summarize();
+    if (_symmetric_learning)
+        _symmetric_learning->summarize();
 }
 
 
@@ -0,0 +1,59 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_SYMMETRYDATA_H_
+#define INCLUDE_COSY_SYMMETRYDATA_H_
+
+#include <memory>
+
+#include "cosy/CNFModel.h"
+#include "cosy/Group.h"
+#include "cosy/Macros.h"
+#include "cosy/Order.h"
+
+namespace cosy {
+
+// Part of the symmetry breaking that does not change during search: the
+// model, its group and a static order. It is filled by one controller, then
+// only read, so a single instance can be shared by the controllers of
+// several solver threads, see SymmetryController::sharedData(). Everything
+// that follows the search (assignment, statuses, injector) stays in each
+// controller.
+class SymmetryData {
+ public:
+    explicit SymmetryData(unsigned int num_vars);
+    ~SymmetryData() {}
+
+    unsigned int numberOfVariables() const { return _num_vars; }
+    void setNumberOfVariables(unsigned int num_vars) { _num_vars = num_vars; }
+
+    const CNFModel& model() const { return _cnf_model; }
+    CNFModel* mutableModel() { return &_cnf_model; }
+    const Group& group() const { return _group; }
+    Group* mutableGroup() { return &_group; }
+
+    // Build the order of the given modes, the DYNAMIC order follows the
+    // decisions of one solver and is never shared.
+    void defineOrder(OrderMode vars, ValueMode value);
+    // Return nullptr when no order of these modes was defined.
+    std::shared_ptr<const Order> order(OrderMode vars, ValueMode value) const;
+
+ private:
+    unsigned int _num_vars;
+    CNFModel _cnf_model;
+    Group _group;
+
+    OrderMode _order_mode;
+    std::shared_ptr<const Order> _order;
+
+    DISALLOW_COPY_AND_ASSIGN(SymmetryData);
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_SYMMETRYDATA_H_
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
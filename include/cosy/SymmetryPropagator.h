@@ -0,0 +1,106 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_SYMMETRYPROPAGATOR_H_
+#define INCLUDE_COSY_SYMMETRYPROPAGATOR_H_
+
+#include <deque>
+#include <vector>
+
+#include "cosy/Assignment.h"
+#include "cosy/Group.h"
+#include "cosy/IntegralTypes.h"
+#include "cosy/Literal.h"
+#include "cosy/Macros.h"
+#include "cosy/Permutation.h"
+#include "cosy/Stats.h"
+
+namespace cosy {
+
+// Symmetry propagation (SP): a generator g is weakly active when the image
+// of every decision is true, g(decisions) is then a subset of the
+// assignment and any propagated literal l implies g(l), its reason being
+// the image of the reason of l.
+//
+// For each generator the number of decisions whose image is not true is
+// maintained on assignment and cancellation, so the weakly active test is
+// a comparison with zero. Implications are queued when a literal is
+// propagated while a generator is weakly active; the reason is only built
+// when the solver asks for it. The solver should enqueue implications once
+// its own propagation reached a fixpoint, so that the image of the reason
+// is falsified except for the implied literal. Pending implications are
+// dropped on cancellation, the ones the solver does not use must be
+// discarded.
+class SymmetryPropagator {
+ public:
+    SymmetryPropagator(const Group& group, const Assignment& assignment);
+    ~SymmetryPropagator() {}
+
+    // The assignment must already contain the literal.
+    void updateNotify(const Literal& literal, bool is_decision);
+    // The assignment must not contain the literal anymore.
+    void updateCancel(const Literal& literal);
+
+    bool isWeaklyActive(int64 permutation) const {
+        return _num_unsatisfied[permutation] == 0;
+    }
+
+    bool hasImplication() const { return !_pending.empty(); }
+    Literal nextImplication();
+    // The implication is not used, its variable can be implied again.
+    void discard(const Literal& implied) {
+        _is_implied[implied.variable().value()] = false;
+    }
+
+    // Literal whose propagation implied the given one.
+    Literal source(const Literal& implied) const;
+    // Image of the reason of source(implied), implied literal first.
+    std::vector<Literal> reason(const Literal& implied,
+                                const std::vector<Literal>& source_reason) const;
+
+    void printStats() const { _stats.print(); }
+
+ private:
+    struct Implication {
+        int64 permutation;
+        Literal source;
+    };
+
+    const Group& _group;
+    const Assignment& _assignment;
+
+    // Number of decisions whose image is not true, per generator
+    std::vector<int64> _num_unsatisfied;
+    std::vector<bool> _is_decision;
+    std::vector< std::vector<int64> > _watchers;
+
+    std::vector<Implication> _implication_of;
+    std::vector<bool> _is_implied;
+    std::deque<Literal> _pending;
+
+    void implies(const Literal& literal);
+
+    struct Stats : public StatsGroup {
+        Stats() : StatsGroup("Symmetry Propagation"),
+                  notify_time("SP notify time", this),
+                  implications("Number of implications", this),
+                  conflicts("Number of conflicting implications", this)
+        {}
+        TimeDistribution notify_time;
+        CounterStat implications;
+        CounterStat conflicts;
+    };
+    Stats _stats;
+
+    DISALLOW_COPY_AND_ASSIGN(SymmetryPropagator);
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_SYMMETRYPROPAGATOR_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
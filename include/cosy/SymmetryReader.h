@@ -0,0 +1,84 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_SYMMETRYREADER_H_
+#define INCLUDE_COSY_SYMMETRYREADER_H_
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cosy/Group.h"
+#include "cosy/Literal.h"
+#include "cosy/Permutation.h"
+#include "cosy/StreamBuffer.h"
+
+namespace cosy {
+
+// Read generators written in cycle notation. All the supported formats only
+// differ by the meaning of the integers inside cycles and by how generators
+// are delimited, the scanning is shared:
+//  - a generator is a sequence of cycles "(a b c)" on a single line, values
+//    are separated by blanks or commas,
+//  - any character outside cycles is ignored, so decorations such as
+//    "Generator:", "[", "]" or trailing commas are accepted,
+//  - lines starting with 'c' or '#' are comments,
+//  - generators that move a literal twice or contain an out of range value
+//    are dropped.
+// Cycles are read directly into the Permutation; when a file only describes
+// the positive part of a generator, the negated cycles are completed.
+class SymmetryReader {
+ public:
+    enum Format {
+        SAUCY,
+        BREAKID,
+        BLISS,
+        DREADNAUT,
+        BINARY,
+    };
+
+    virtual ~SymmetryReader() {}
+
+    virtual bool load(const std::string& symmetry_filename,
+                      unsigned int num_vars, Group *group);
+
+    virtual std::string formatName() const = 0;
+
+    static SymmetryReader* create(Format format);
+
+ protected:
+    SymmetryReader() : _num_dropped(0) {}
+
+    // Convert a value read in a cycle to a signed literal. A null literal
+    // means that the value is valid but is not a literal (e.g. a clause node
+    // of the graph) and must be skipped. Readers that replace load() do not
+    // scan cycles and keep the default.
+    virtual bool toSignedLiteral(int /*value*/, unsigned int /*num_vars*/,
+                                 int * /*literal*/) const { return false; }
+
+    // True when a line starting with a blank continues the previous
+    // generator (e.g. dreadnaut wraps long generators).
+    virtual bool hasContinuationLines() const { return false; }
+
+    unsigned int _num_dropped;
+    std::vector<Literal> _cycle;
+    std::vector<bool> _seen;
+
+    void addGenerator(std::unique_ptr<Permutation> generator, bool valid,
+                      Group *group);
+
+ private:
+    bool readCycle(StreamBuffer *in, unsigned int num_vars,
+                   Permutation *generator);
+    void completeNegatedCycles(Permutation *generator);
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_SYMMETRYREADER_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,56 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#ifndef INCLUDE_COSY_SYMMETRYWRITER_H_
+#define INCLUDE_COSY_SYMMETRYWRITER_H_
+
+#include <string>
+
+#include "cosy/Group.h"
+#include "cosy/Literal.h"
+#include "cosy/Permutation.h"
+#include "cosy/StreamWriter.h"
+
+namespace cosy {
+
+// Export the generators of a Group in one of the formats understood by
+// SymmetryReader. The output goes through a StreamWriter so that groups with
+// millions of cycle elements are written without formatting overhead.
+class SymmetryWriter {
+ public:
+    enum Format {
+        SAUCY,
+        BREAKID,
+        BINARY,
+    };
+
+    virtual ~SymmetryWriter() {}
+
+    bool write(const std::string& symmetry_filename, unsigned int num_vars,
+               const Group& group);
+
+    virtual std::string formatName() const = 0;
+
+    static SymmetryWriter* create(Format format);
+
+ protected:
+    SymmetryWriter() {}
+
+    virtual void writeHeader(unsigned int /*num_vars*/,
+                             const Group& /*group*/,
+                             StreamWriter * /*out*/) {}
+    virtual void writeGenerator(unsigned int num_vars,
+                                const Permutation& generator, bool last,
+                                StreamWriter *out) = 0;
+    virtual void writeFooter(StreamWriter * /*out*/) {}
+};
+
+}  // namespace cosy
+
+#endif  // INCLUDE_COSY_SYMMETRYWRITER_H_
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
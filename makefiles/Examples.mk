@@ -1,13 +1,18 @@
 
 EXAMPLES := examples/
 
-examples: default $(BIN)CNFBlissSymmetries $(BIN)CNFSaucySymmetries
-solvers: $(BIN)glucose_release
+examples: default $(BIN)CNFBlissSymmetries $(BIN)CNFSaucySymmetries \
+	$(BIN)CNFSnapshot $(BIN)CNFStaticBreaking $(BIN)CNFSharedMemory
+solvers: $(BIN)glucose_release $(BIN)glucose_portfolio
 
 $(call REQUIRE-DIR, $(BIN)CNFBlissSymmetries)
 $(call REQUIRE-DIR, $(BIN)CNFSaucySymmetries)
+$(call REQUIRE-DIR, $(BIN)CNFSnapshot)
+$(call REQUIRE-DIR, $(BIN)CNFStaticBreaking)
+$(call REQUIRE-DIR, $(BIN)CNFSharedMemory)
 $(call REQUIRE-DIR, $(BIN)minisat)
 $(call REQUIRE-DIR, $(BIN)glucose_release)
+$(call REQUIRE-DIR, $(BIN)glucose_portfolio)
 
 
 $(BIN)CNFBlissSymmetries: LDFLAGS += -lcosy -lbliss  -lz
@@ -18,6 +23,18 @@ $(BIN)CNFSaucySymmetries: LDFLAGS += -lcosy -lsaucy  -lz
 $(BIN)CNFSaucySymmetries: $(EXAMPLES)CNFSaucySymmetries.cc
 	$(call cmd-cxx-bin, $@, $<, $(LDFLAGS))
 
+$(BIN)CNFSnapshot: LDFLAGS += -lcosy -lbliss  -lz
+$(BIN)CNFSnapshot: $(EXAMPLES)CNFSnapshot.cc
+	$(call cmd-cxx-bin, $@, $<, $(LDFLAGS))
+
+$(BIN)CNFStaticBreaking: LDFLAGS += -lcosy -lbliss  -lz
+$(BIN)CNFStaticBreaking: $(EXAMPLES)CNFStaticBreaking.cc
+	$(call cmd-cxx-bin, $@, $<, $(LDFLAGS))
+
+$(BIN)CNFSharedMemory: LDFLAGS += -lcosy -lbliss -lsaucy -lz
+$(BIN)CNFSharedMemory: $(EXAMPLES)CNFSharedMemory.cc
+	$(call cmd-cxx-bin, $@, $<, $(LDFLAGS))
+
 
 ##### Solvers
 # Minisat
@@ -33,8 +50,23 @@ $(BIN)glucose_release: default FORCE
 	$(call cmd-make, r, $(EXAMPLES)solvers/glucose-3.0/core)
 	$(call cmd-cp, $@, $(EXAMPLES)solvers/glucose-3.0/core/glucose_release)
 
+# Glucose workers in threads with diversified symmetry breaking
+$(BIN)glucose_portfolio: default FORCE
+	$(call cmd-make, clean, $(EXAMPLES)solvers/glucose-3.0/portfolio)
+	$(call cmd-make, r, $(EXAMPLES)solvers/glucose-3.0/portfolio)
+	$(call cmd-cp, $@, $(EXAMPLES)solvers/glucose-3.0/portfolio/glucose_portfolio_release)
+
+# Glucose with cosy behind the IPASIR interface, link with
+# -lipasirglucosecosy -lcosy -lbliss -lsaucy -lz
+ipasir: $(LIB)libipasirglucosecosy.a
+
+$(LIB)libipasirglucosecosy.a: default FORCE
+	$(call cmd-make, clean, $(EXAMPLES)solvers/glucose-3.0/ipasir)
+	$(call cmd-make, libr, $(EXAMPLES)solvers/glucose-3.0/ipasir)
+	$(call cmd-cp, $@, $(EXAMPLES)solvers/glucose-3.0/ipasir/libipasirglucosecosy_release.a)
+
 clean-solvers:
 	$(call cmd-make, clean, $(EXAMPLES)solvers/minisat/core)
 
 
-.PHONY: examples FORCE
+.PHONY: examples ipasir FORCE
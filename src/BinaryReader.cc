@@ -0,0 +1,136 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/BinaryReader.h"
+
+#include <memory>
+
+namespace cosy {
+
+namespace {
+
+bool readVarint(StreamBuffer *in, uint64 *value) {
+    StreamBuffer& stream = *in;
+    uint64 result = 0;
+
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (stream.eof())
+            return false;
+        const uint64 byte = static_cast<unsigned char>(*stream);
+        ++stream;
+        result |= (byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            *value = result;
+            return true;
+        }
+    }
+    return false;
+}
+
+}  // namespace
+
+bool BinaryReader::load(const std::string& symmetry_filename,
+                        unsigned int num_vars, Group *group) {
+    StreamBuffer in(symmetry_filename);
+    uint64 version, file_num_vars, num_generators;
+
+    for (const char c : kBinarySymmetryMagic) {
+        if (in.eof() || *in != c) {
+            LOG(ERROR) << symmetry_filename << " is not a binary symmetry file";
+            return false;
+        }
+        ++in;
+    }
+
+    if (!readVarint(&in, &version) || !readVarint(&in, &file_num_vars) ||
+        !readVarint(&in, &num_generators)) {
+        LOG(ERROR) << symmetry_filename << " is truncated";
+        return false;
+    }
+    if (version != kBinarySymmetryVersion) {
+        LOG(ERROR) << "Binary symmetry version " << version
+                   << " not supported";
+        return false;
+    }
+    if (file_num_vars > num_vars) {
+        LOG(ERROR) << symmetry_filename << " has " << file_num_vars
+                   << " variables, expected at most " << num_vars;
+        return false;
+    }
+
+    _num_dropped = 0;
+    _seen.assign(2 * num_vars, false);
+
+    for (uint64 g = 0; g < num_generators; g++) {
+        if (!readGenerator(&in, num_vars, group)) {
+            LOG(ERROR) << symmetry_filename << " is truncated";
+            return false;
+        }
+    }
+
+    if (_num_dropped > 0)
+        LOG(WARNING) << _num_dropped << " malformed generators dropped from "
+                     << symmetry_filename;
+    return true;
+}
+
+bool BinaryReader::readGenerator(StreamBuffer *in, unsigned int num_vars,
+                                 Group *group) {
+    std::unique_ptr<Permutation> generator(new Permutation(num_vars));
+    const int64 num_literals = 2 * static_cast<int64>(num_vars);
+    uint64 num_cycles;
+    bool valid = true;
+
+    if (!readVarint(in, &num_cycles))
+        return false;
+
+    for (uint64 c = 0; c < num_cycles; c++) {
+        uint64 length, encoded;
+        bool valid_cycle = true;
+        int64 index = 0;
+
+        if (!readVarint(in, &length))
+            return false;
+
+        _cycle.clear();
+        for (uint64 i = 0; i < length; i++) {
+            if (!readVarint(in, &encoded))
+                return false;
+            if (i == 0)
+                index = encoded;
+            else
+                index += static_cast<int64>(encoded >> 1) ^
+                    -static_cast<int64>(encoded & 1);
+
+            if (index < 0 || index >= num_literals || _seen[index]) {
+                valid_cycle = false;
+                continue;
+            }
+            _seen[index] = true;
+            _cycle.push_back(Literal(LiteralIndex(index)));
+        }
+
+        // Fixed points and rejected cycles never reach the generator
+        if (!valid_cycle || _cycle.size() < 2) {
+            for (const Literal& element : _cycle)
+                _seen[element.index().value()] = false;
+            valid = valid && valid_cycle;
+            continue;
+        }
+
+        for (const Literal& element : _cycle)
+            generator->addToCurrentCycle(element);
+        generator->closeCurrentCycle();
+    }
+
+    addGenerator(std::move(generator), valid, group);
+    return true;
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,48 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/BinaryWriter.h"
+
+namespace cosy {
+
+void BinaryWriter::writeHeader(unsigned int num_vars, const Group& group,
+                               StreamWriter *out) {
+    out->writeBytes(kBinarySymmetryMagic, sizeof(kBinarySymmetryMagic));
+    out->writeVarint(kBinarySymmetryVersion);
+    out->writeVarint(num_vars);
+    out->writeVarint(group.numberOfPermutations());
+}
+
+void BinaryWriter::writeGenerator(unsigned int /*num_vars*/,
+                                  const Permutation& generator,
+                                  bool /*last*/, StreamWriter *out) {
+    out->writeVarint(generator.numberOfCycles());
+
+    for (unsigned int c = 0; c < generator.numberOfCycles(); ++c) {
+        const Permutation::Iterator cycle = generator.cycle(c);
+        int64 previous = 0;
+        bool first = true;
+
+        out->writeVarint(cycle.size());
+        for (const Literal& element : cycle) {
+            const int64 index = element.index().value();
+            if (first) {
+                out->writeVarint(index);
+                first = false;
+            } else {
+                const int64 delta = index - previous;
+                out->writeVarint((static_cast<uint64>(delta) << 1) ^
+                                 static_cast<uint64>(delta >> 63));
+            }
+            previous = index;
+        }
+    }
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,25 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/BreakIDReader.h"
+
+namespace cosy {
+
+bool BreakIDReader::toSignedLiteral(int value, unsigned int num_vars,
+                                    int *literal) const {
+    const int n = num_vars;
+
+    if (value == 0 || value > n || value < -n)
+        return false;
+
+    *literal = value;
+    return true;
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,31 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/BreakIDWriter.h"
+
+namespace cosy {
+
+void BreakIDWriter::writeGenerator(unsigned int /*num_vars*/,
+                                   const Permutation& generator,
+                                   bool /*last*/,
+                                   StreamWriter *out) {
+    for (unsigned int c = 0; c < generator.numberOfCycles(); ++c) {
+        if (c > 0)
+            out->writeChar(' ');
+        out->writeString("( ");
+        for (const Literal& element : generator.cycle(c)) {
+            out->writeInt(element.signedValue());
+            out->writeChar(' ');
+        }
+        out->writeChar(')');
+    }
+    out->writeChar('\n');
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
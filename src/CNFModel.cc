@@ -11,7 +11,8 @@ CNFModel::CNFModel() :
     _num_unary_clauses(0),
     _num_binary_clauses(0),
     _num_ternary_clauses(0),
-    _num_large_clauses(0) {
+    _num_large_clauses(0),
+    _has_tags(true) {
 }
 
 CNFModel::~CNFModel() {
@@ -31,6 +32,8 @@ void CNFModel::addClause(std::vector<Literal>* literals) {
 
     _num_clauses++;
 
+    if (!_has_tags)
+        compute_tags();
     size_t tag = compute_tag(*literals);
 
     // If clause already exists do nothing
@@ -45,10 +48,24 @@ void CNFModel::addClause(std::vector<Literal>* literals) {
 }
 
 size_t CNFModel::compute_tag(const std::vector<Literal>& literals) {
-    std::string word = "";
-    for (const Literal& literal : literals)
-        word += std::to_string(literal.signedValue()) + " ";
-    return std::hash<std::string>()(word);
+    // FNV-1a on the literal indexes, the literals are sorted
+    uint64 tag = 14695981039346656037ULL;
+    for (const Literal& literal : literals) {
+        tag ^= static_cast<uint64>(literal.index().value());
+        tag *= 1099511628211ULL;
+    }
+    return static_cast<size_t>(tag);
+}
+
+void CNFModel::compute_tags() {
+    std::vector<Literal> literals;
+
+    _clauses_tag.reserve(_clauses.size());
+    for (const std::unique_ptr<Clause>& clause : _clauses) {
+        literals.assign(clause->begin(), clause->end());
+        _clauses_tag.insert(compute_tag(literals));
+    }
+    _has_tags = true;
 }
 
 void CNFModel::compute_occurences(const std::vector<Literal>& literals) {
@@ -0,0 +1,85 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/ClauseCache.h"
+
+#include <algorithm>
+
+namespace cosy {
+
+ClauseCache::ClauseCache(unsigned int capacity) :
+    _capacity(capacity),
+    _num_hits(0),
+    _num_misses(0) {
+    CHECK_GT(capacity, 0);
+}
+
+uint64 ClauseCache::sortAndHash(const std::vector<Literal>& literals) {
+    _sorted.assign(literals.begin(), literals.end());
+    std::sort(_sorted.begin(), _sorted.end());
+
+    // FNV-1a on the literal indexes
+    uint64 hash = 14695981039346656037ULL;
+    for (const Literal& literal : _sorted) {
+        hash ^= static_cast<uint64>(literal.index().value());
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+bool ClauseCache::contains(const std::vector<Literal>& literals) {
+    const uint64 hash = sortAndHash(literals);
+    auto it = _index.find(hash);
+
+    if (it == _index.end() || it->second->literals != _sorted) {
+        _num_misses++;
+        IF_STATS_ENABLED(_stats.misses.increment());
+        return false;
+    }
+
+    _entries.splice(_entries.begin(), _entries, it->second);
+    _num_hits++;
+    IF_STATS_ENABLED(_stats.hits.increment());
+    return true;
+}
+
+void ClauseCache::insert(const std::vector<Literal>& literals) {
+    const uint64 hash = sortAndHash(literals);
+    auto it = _index.find(hash);
+
+    if (it != _index.end()) {
+        it->second->literals = _sorted;
+        _entries.splice(_entries.begin(), _entries, it->second);
+        return;
+    }
+
+    if (_entries.size() == _capacity) {
+        _index.erase(_entries.back().hash);
+        _entries.pop_back();
+        IF_STATS_ENABLED(_stats.evictions.increment());
+    }
+
+    _entries.push_front(Entry());
+    _entries.front().hash = hash;
+    _entries.front().literals = _sorted;
+    _index[hash] = _entries.begin();
+}
+
+void ClauseCache::erase(const std::vector<Literal>& literals) {
+    const uint64 hash = sortAndHash(literals);
+    auto it = _index.find(hash);
+
+    if (it == _index.end() || it->second->literals != _sorted)
+        return;
+
+    _entries.erase(it->second);
+    _index.erase(it);
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -4,7 +4,9 @@
 
 namespace cosy {
 
-ClauseInjector::ClauseInjector() {
+ClauseInjector::ClauseInjector() :
+    _minimizer(nullptr),
+    _cache(nullptr) {
     _injectors.resize(NR_TYPES);
 }
 
@@ -14,7 +16,12 @@ ClauseInjector::~ClauseInjector() {
 
 void ClauseInjector::addClause(Type type, BooleanVariable cause,
                                std::vector<Literal>&& literals) {
-    _injectors[type].addClause(cause, std::move(literals));
+    unsigned int lbd = 0;
+    if (_minimizer != nullptr && isESBP(type))
+        lbd = _minimizer->minimize(&literals);
+    if (_cache && isESBP(type) && _cache->contains(literals))
+        return;
+    _injectors[type].addClause(cause, std::move(literals), lbd);
 }
 
 void ClauseInjector::removeClause(Type type, BooleanVariable cause) {
@@ -31,9 +38,13 @@ ClauseInjector::getClause(Type type, BooleanVariable cause) {
     case UNITS:        _stats.units.increment();           break;
     case ESBP:         _stats.esbp.increment();            break;
     case ESBP_FORCING: _stats.esbp_forcing.increment();    break;
+    case SYMMETRIC_LEARNT: _stats.symmetric_learnt.increment(); break;
     default: CHECK_NOTNULL(nullptr);
     }
-    return _injectors[type].getClause(cause);
+    std::vector<Literal> literals = _injectors[type].getClause(cause);
+    if (_cache && isESBP(type))
+        _cache->insert(literals);
+    return literals;
 }
 
 void ClauseInjector::removeClause(BooleanVariable cause) {
@@ -0,0 +1,91 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/ClauseMinimizer.h"
+
+#include <algorithm>
+
+namespace cosy {
+
+ClauseMinimizer::ClauseMinimizer(const Assignment& assignment,
+                                 const std::vector<unsigned int>& levels) :
+    _assignment(assignment),
+    _levels(levels),
+    _mode(NO_MINIMIZATION),
+    _reasons(nullptr),
+    _in_clause(2 * assignment.numberOfVariables(), false) {
+}
+
+unsigned int ClauseMinimizer::minimize(std::vector<Literal> *literals) {
+    CHECK_NOTNULL(literals);
+
+    if (_mode != NO_MINIMIZATION && literals->size() > 2) {
+        IF_STATS_ENABLED(_stats.clauses.increment());
+
+        for (const Literal& literal : *literals)
+            _in_clause[literal.index().value()] = true;
+
+        // Removed literals stay marked while the clause is scanned: by trail
+        // order, they are implied by the literals kept
+        _redundant.assign(literals->size(), false);
+        for (unsigned int i = 2; i < literals->size(); i++)
+            _redundant[i] = isRedundant((*literals)[i]);
+
+        for (const Literal& literal : *literals)
+            _in_clause[literal.index().value()] = false;
+
+        unsigned int size = 2;
+        for (unsigned int i = 2; i < literals->size(); i++)
+            if (!_redundant[i])
+                (*literals)[size++] = (*literals)[i];
+        literals->resize(size);
+    }
+
+    return computeLBD(*literals);
+}
+
+bool ClauseMinimizer::isRedundant(Literal literal) {
+    if (!_assignment.literalIsFalse(literal))
+        return false;
+
+    if (_levels[literal.variable().value()] == 0) {
+        IF_STATS_ENABLED(_stats.level_zero.increment());
+        return true;
+    }
+
+    if (_mode != REASON_MINIMIZATION || _reasons == nullptr)
+        return false;
+
+    _reason.clear();
+    if (!_reasons->reason(literal.negated(), &_reason))
+        return false;
+
+    for (const Literal& other : _reason) {
+        if (other.variable() == literal.variable())
+            continue;
+        if (!_in_clause[other.index().value()] && !isFalseAtLevelZero(other))
+            return false;
+    }
+    IF_STATS_ENABLED(_stats.reasons.increment());
+    return true;
+}
+
+unsigned int
+ClauseMinimizer::computeLBD(const std::vector<Literal>& literals) {
+    _clause_levels.clear();
+    for (const Literal& literal : literals)
+        if (_assignment.literalIsAssigned(literal))
+            _clause_levels.push_back(_levels[literal.variable().value()]);
+
+    std::sort(_clause_levels.begin(), _clause_levels.end());
+    return std::unique(_clause_levels.begin(), _clause_levels.end()) -
+        _clause_levels.begin();
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -2,43 +2,360 @@
 
 #include "cosy/CosyManager.h"
 
-namespace cosy {
+#include <algorithm>
+#include <utility>
+
+#include "cosy/SchreierSims.h"
 
-static const bool FLAGS_esbp = true;
-static const bool FLAGS_esbp_forcing = false;
+namespace cosy {
 
 CosyManager::CosyManager(const Group& group, const Assignment& assignment) :
     _group(group),
     _assignment(assignment),
-    _order(nullptr) {
+    _order(nullptr),
+    _dynamic_order(nullptr),
+    _propagator(nullptr),
+    _num_generator_statuses(0),
+    _num_row_statuses(0),
+    _esbp(true),
+    _esbp_forcing(false),
+    _max_esbp_size(0),
+    _check_period(0),
+    _max_sleep(0),
+    _num_sleeping(0),
+    _level_zero_simplification(false),
+    _num_assigned(0),
+    _num_simplified(0),
+    _num_settled(0),
+    _max_esbp_per_literal(1),
+    _esbp_selection(SHORTEST_ESBP),
+    _levels(assignment.numberOfVariables(), 0),
+    _minimizer(new ClauseMinimizer(assignment, _levels)),
+    _in_assumptions(2 * assignment.numberOfVariables(), false) {
 }
 
 CosyManager::~CosyManager() {
 }
 
 
-void CosyManager::defineOrder(std::unique_ptr<Order>&& order) {
+void CosyManager::defineOrder(std::unique_ptr<Order>&& order,
+                              unsigned int max_stabilizer_statuses,
+                              bool row_interchangeability) {
+    _dynamic_order = dynamic_cast<DynamicOrder*>(order.get());
     _order = std::move(order);
+    addStatuses(max_stabilizer_statuses, row_interchangeability);
+}
+
+void CosyManager::defineOrder(const std::shared_ptr<const Order>& order,
+                              unsigned int max_stabilizer_statuses,
+                              bool row_interchangeability) {
+    CHECK(dynamic_cast<const DynamicOrder*>(order.get()) == nullptr);
+    _dynamic_order = nullptr;
+    _order = order;
+    addStatuses(max_stabilizer_statuses, row_interchangeability);
+}
+
+void CosyManager::addStatuses(unsigned int max_stabilizer_statuses,
+                              bool row_interchangeability) {
+    _watchers.assign(_assignment.numberOfVariables(),
+                     std::vector<unsigned int>());
 
-    for (const std::unique_ptr<Permutation>& perm : _group.permutations()) {
-        std::unique_ptr<CosyStatus> status
-            (new CosyStatus(*perm, *_order, _assignment));
-        _statuses.emplace_back(status.release());
+    if (row_interchangeability) {
+        addRowStatuses();
+    } else {
+        for (const std::unique_ptr<Permutation>& perm : _group.permutations())
+            addStatus(*perm);
+        _num_generator_statuses = _statuses.size();
     }
 
+    if (max_stabilizer_statuses > 0)
+        addStabilizerStatuses(max_stabilizer_statuses);
+
     for (const Literal& literal : *_order) {
         const BooleanVariable variable = literal.variable();
-        for (const unsigned int& index : _group.watch(variable))
+        for (const unsigned int& index : _watchers[variable.value()])
             _statuses[index]->addLookupLiteral(literal);
     }
 }
 
+void CosyManager::addStatus(const Permutation& permutation) {
+    std::unique_ptr<CosyStatus> status
+        (new CosyStatus(permutation, *_order, _assignment));
+    watchStatus(_statuses.size(), permutation);
+    _statuses.emplace_back(status.release());
+    _permutations.push_back(&permutation);
+    _activities.push_back(Activity());
+    _disabled.push_back(false);
+    _gave_clauses.push_back(false);
+    _settled.push_back(false);
+}
+
+void CosyManager::addRowStatuses() {
+    RowInterchangeability detector(_assignment.numberOfVariables());
+    detector.detect(_group);
+
+    for (int64 i = 0; i < _group.numberOfPermutations(); i++) {
+        if (!detector.isCovered(i))
+            addStatus(*_group.permutations()[i]);
+    }
+    _num_generator_statuses = _statuses.size();
+
+    for (const std::unique_ptr<LiteralMatrix>& matrix : detector.matrices()) {
+        std::unique_ptr<RowOrdering> ordering
+            (new RowOrdering(*matrix, *_order,
+                             _assignment.numberOfVariables()));
+        for (const std::unique_ptr<Permutation>& swap : ordering->swaps())
+            addStatus(*swap);
+        _row_orderings.emplace_back(ordering.release());
+    }
+    _num_row_statuses = _statuses.size() - _num_generator_statuses;
+}
+
+void CosyManager::extendOrder(BooleanVariable variable) {
+    const std::vector<unsigned int>& watchers = _watchers[variable.value()];
+    if (watchers.empty() || !_dynamic_order->append(variable))
+        return;
+
+    const Literal literal(variable, true);
+    for (const unsigned int& index : watchers)
+        _statuses[index]->addLookupLiteral(literal);
+}
+
+void CosyManager::watchStatus(unsigned int index,
+                              const Permutation& permutation) {
+    for (const Literal& literal : permutation.support()) {
+        std::vector<unsigned int>& watchers =
+            _watchers[literal.variable().value()];
+        if (watchers.empty() || watchers.back() != index)
+            watchers.push_back(index);
+    }
+}
+
+void CosyManager::addStabilizerStatuses(unsigned int max_statuses) {
+    const std::vector<Literal> base_hint(_order->begin(), _order->end());
+    SchreierSims chain(_group, _assignment.numberOfVariables());
+    unsigned int num_added = 0;
+
+    // A partial chain still only contains group elements, so it is used
+    // even if the budget is exhausted.
+    if (!chain.compute(base_hint, SchreierSims::Budget()))
+        LOG(WARNING) << "Stabilizer chain is incomplete";
+
+    auto before = [this](const Literal& a, const Literal& b) {
+        return _order->leq(a, b) == a && _order->leq(b, a) == a;
+    };
+
+    // For each base point b, the inverse u^-1 of the coset representative
+    // mapping b to a later literal l sends l to b: its lex-leader constraint
+    // compares b with l right after the previous base points.
+    for (unsigned int level = 0; level < chain.baseSize(); level++) {
+        const Literal base_point = chain.basePoint(level);
+        std::vector<Literal> orbit = chain.basicOrbit(level);
+
+        std::sort(orbit.begin(), orbit.end(), before);
+        for (const Literal& literal : orbit) {
+            if (num_added == max_statuses)
+                return;
+            if (literal.variable() == base_point.variable() ||
+                !before(base_point, literal))
+                continue;
+
+            std::unique_ptr<Permutation> permutation =
+                chain.inverseCosetRepresentative(level, literal);
+            addStatus(*permutation);
+            _stabilizer_permutations.emplace_back(permutation.release());
+            num_added++;
+        }
+    }
+}
+
+void CosyManager::enableSymmetryPropagation() {
+    _propagator = std::unique_ptr<SymmetryPropagator>
+        (new SymmetryPropagator(_group, _assignment));
+}
+
+void CosyManager::enableAdaptiveSleep(int64 check_period,
+                                      unsigned int max_sleep) {
+    CHECK_GT(check_period, 0);
+    _check_period = check_period;
+    _max_sleep = max_sleep;
+}
+
+void CosyManager::enableLevelZeroSimplification() {
+    _level_zero_simplification = true;
+}
+
+void CosyManager::setMaxESBPPerLiteral(unsigned int max,
+                                       ESBPSelection selection) {
+    CHECK_GT(max, 0);
+    _max_esbp_per_literal = max;
+    _esbp_selection = selection;
+}
+
+void CosyManager::setESBPPolicy(bool esbp, bool forcing,
+                                unsigned int max_size) {
+    _esbp = esbp;
+    _esbp_forcing = forcing;
+    _max_esbp_size = max_size;
+}
+
+void CosyManager::unwatchStatus(unsigned int index,
+                                const Permutation& permutation) {
+    for (const Literal& literal : permutation.support()) {
+        std::vector<unsigned int>& watchers =
+            _watchers[literal.variable().value()];
+        auto it = std::lower_bound(watchers.begin(), watchers.end(), index);
+        if (it != watchers.end() && *it == index)
+            watchers.erase(it);
+    }
+}
+
+void CosyManager::checkActivity(unsigned int index) {
+    const CosyStatus& status = *_statuses[index];
+    Activity& activity = _activities[index];
+
+    if (status.numberOfUpdates() - activity.checked_updates < _check_period)
+        return;
+
+    const int64 esbp = status.numberOfESBP() + status.numberOfForcingESBP();
+    if (esbp == activity.checked_esbp) {
+        activity.remaining = activity.sleep_length;
+        activity.sleep_length = std::min(2 * activity.sleep_length,
+                                         _max_sleep);
+        _to_sleep.push_back(index);
+    } else {
+        activity.sleep_length = 1;
+    }
+    activity.checked_updates = status.numberOfUpdates();
+    activity.checked_esbp = esbp;
+}
+
+void CosyManager::restart() {
+    if (_level_zero_simplification && _num_assigned > _num_simplified)
+        simplify();
+    if (_num_sleeping == 0)
+        return;
+
+    for (unsigned int index = 0; index < _statuses.size(); index++) {
+        Activity& activity = _activities[index];
+        if (activity.remaining > 0 && --activity.remaining == 0)
+            wake(index);
+    }
+}
+
+void CosyManager::wake(unsigned int index) {
+    if (!_disabled[index] && !_settled[index])
+        attach(index);
+    _num_sleeping--;
+}
+
+void CosyManager::simplify() {
+    for (unsigned int index = 0; index < _statuses.size(); index++) {
+        if (_settled[index])
+            continue;
+
+        CosyStatus *status = _statuses[index].get();
+        status->compactLookupOrder();
+        if (!status->isSettled())
+            continue;
+
+        _settled[index] = true;
+        _num_settled++;
+        IF_STATS_ENABLED(_stats.settled.increment());
+        if (!_disabled[index] && !isSleeping(index))
+            unwatchStatus(index, *_permutations[index]);
+    }
+    _num_simplified = _num_assigned;
+}
+
+void CosyManager::attach(unsigned int index) {
+    const Permutation& permutation = *_permutations[index];
+    CosyStatus *status = _statuses[index].get();
+
+    // The dynamic order may have grown while the status was asleep
+    if (_dynamic_order) {
+        status->clearLookupOrder();
+        for (const Literal& literal : *_order)
+            if (!permutation.isTrivialImage(literal))
+                status->addLookupLiteral(literal);
+    }
+    status->reset();
+
+    for (const Literal& literal : permutation.support()) {
+        std::vector<unsigned int>& watchers =
+            _watchers[literal.variable().value()];
+        auto it = std::lower_bound(watchers.begin(), watchers.end(), index);
+        if (it == watchers.end() || *it != index)
+            watchers.insert(it, index);
+    }
+}
+
+void CosyManager::markAssumptions(const std::vector<Literal>& assumptions,
+                                  bool value) {
+    for (const Literal& literal : assumptions)
+        _in_assumptions[literal.index().value()] = value;
+}
+
+bool CosyManager::stabilizes(const Permutation& permutation,
+                             const std::vector<Literal>& assumptions) const {
+    for (const Literal& literal : assumptions) {
+        if (permutation.isTrivialImage(literal))
+            continue;
+        if (!_in_assumptions[permutation.imageOf(literal).index().value()])
+            return false;
+    }
+    return true;
+}
+
+bool CosyManager::canRestrictTo(const std::vector<Literal>& assumptions) {
+    bool success = true;
+
+    markAssumptions(assumptions, true);
+    for (unsigned int index = 0; index < _statuses.size() && success; index++)
+        success = !_gave_clauses[index] ||
+            stabilizes(*_permutations[index], assumptions);
+    markAssumptions(assumptions, false);
+
+    return success;
+}
+
+void CosyManager::restrictTo(const std::vector<Literal>& assumptions) {
+    markAssumptions(assumptions, true);
+    for (unsigned int index = 0; index < _statuses.size(); index++) {
+        const bool disabled = !stabilizes(*_permutations[index], assumptions);
+        if (disabled == _disabled[index])
+            continue;
+
+        _disabled[index] = disabled;
+        if (isSleeping(index) || _settled[index])
+            continue;
+        if (disabled)
+            unwatchStatus(index, *_permutations[index]);
+        else
+            attach(index);
+    }
+    markAssumptions(assumptions, false);
+}
+
+bool CosyManager::suggestLiteral(BooleanVariable variable, Literal *literal) {
+    for (const unsigned int& index : _watchers[variable.value()]) {
+        if (_statuses[index]->suggestLiteral(variable, literal)) {
+            IF_STATS_ENABLED(_stats.suggestions.increment());
+            return true;
+        }
+    }
+    return false;
+}
+
 void CosyManager::generateUnits(ClauseInjector *injector) {
-    for (const std::unique_ptr<CosyStatus>& status : _statuses)
-        status->generateUnitClauseOnInverting(injector);
+    for (unsigned int index = 0; index < _statuses.size(); index++) {
+        if (!_disabled[index] &&
+            _statuses[index]->generateUnitClauseOnInverting(injector))
+            _gave_clauses[index] = true;
+    }
 }
 
-void CosyManager::updateNotify(const Literal& literal,
+void CosyManager::updateNotify(const Literal& literal, bool is_decision,
                                ClauseInjector *injector) {
     IF_STATS_ENABLED({
             ScopedTimeDistributionUpdater time(&_stats.total_time);
@@ -46,18 +363,91 @@ void CosyManager::updateNotify(const Literal& literal,
         });
 
     const BooleanVariable variable = literal.variable();
-    for (const unsigned int& index : _group.watch(variable)) {
+
+    _num_assigned++;
+    if (is_decision)
+        _decisions.push_back(variable);
+    _levels[variable.value()] = _decisions.size();
+
+    if (_propagator)
+        _propagator->updateNotify(literal, is_decision);
+    if (_dynamic_order && is_decision)
+        extendOrder(variable);
+
+    for (const unsigned int& index : _watchers[variable.value()]) {
         const std::unique_ptr<CosyStatus>& status = _statuses[index];
 
         status->updateNotify(literal);
 
-        if (FLAGS_esbp && status->state() == REDUCER) {
-            status->generateESBP(literal.variable(), injector);
-            break;
-        } else if (FLAGS_esbp_forcing && status->state() == FORCE_LEX_LEADER) {
+        if (_esbp && status->state() == REDUCER && acceptESBP(*status)) {
+            if (_max_esbp_per_literal == 1) {
+                generateESBP(index, variable, injector);
+                break;
+            }
+            _reducers.push_back(index);
+        } else if (_esbp_forcing && status->state() == FORCE_LEX_LEADER &&
+                   acceptESBP(*status)) {
             status->generateForceLexLeaderESBP(literal.variable(), injector);
+            _gave_clauses[index] = true;
         }
+
+        if (_check_period > 0)
+            checkActivity(index);
+    }
+
+    if (!_reducers.empty())
+        generateSelectedESBP(variable, injector);
+
+    // Watch lists can not change while they are traversed
+    for (const unsigned int& index : _to_sleep) {
+        unwatchStatus(index, *_permutations[index]);
+        _num_sleeping++;
+        IF_STATS_ENABLED(_stats.sleeps.increment());
+    }
+    _to_sleep.clear();
+}
+
+bool CosyManager::acceptESBP(const CosyStatus& status) {
+    // Each lookup element up to the current one brings at most two literals
+    if (_max_esbp_size == 0 || 2 * (status.lookupIndex() + 1) <= _max_esbp_size)
+        return true;
+    IF_STATS_ENABLED(_stats.skipped_esbp.increment());
+    return false;
+}
+
+void CosyManager::generateESBP(unsigned int index, BooleanVariable cause,
+                               ClauseInjector *injector) {
+    _statuses[index]->generateESBP(cause, injector);
+    _gave_clauses[index] = true;
+    IF_STATS_ENABLED({
+            if (index < _num_generator_statuses)
+                _stats.generator_esbp.increment();
+            else if (index < _num_generator_statuses + _num_row_statuses)
+                _stats.row_esbp.increment();
+            else
+                _stats.stabilizer_esbp.increment();
+        });
+}
+
+void CosyManager::generateSelectedESBP(BooleanVariable cause,
+                                       ClauseInjector *injector) {
+    std::vector<std::pair<unsigned int, unsigned int>> keys;
+
+    for (const unsigned int& index : _reducers) {
+        const CosyStatus& status = *_statuses[index];
+        const unsigned int key = _esbp_selection == LOWEST_LEVEL_ESBP ?
+            status.esbpLevel(_levels) : status.lookupIndex();
+        keys.push_back(std::make_pair(key, index));
     }
+    _reducers.clear();
+
+    const unsigned int num_selected =
+        std::min<unsigned int>(keys.size(), _max_esbp_per_literal);
+    std::partial_sort(keys.begin(), keys.begin() + num_selected, keys.end());
+
+    // The injector returns the last added clause first
+    for (int i = num_selected - 1; i >= 0; i--)
+        generateESBP(keys[i].second, cause, injector);
 }
 
 void CosyManager::updateCancel(const Literal& literal) {
@@ -66,8 +456,15 @@ void CosyManager::updateCancel(const Literal& literal) {
             time.alsoUpdate(&_stats.cancel_time);
         });
 
+    _num_assigned--;
+    if (!_decisions.empty() && _decisions.back() == literal.variable())
+        _decisions.pop_back();
+
+    if (_propagator)
+        _propagator->updateCancel(literal);
+
     const BooleanVariable variable = literal.variable();
-    for (const unsigned int& index : _group.watch(variable)) {
+    for (const unsigned int& index : _watchers[variable.value()]) {
         const std::unique_ptr<CosyStatus>& status = _statuses[index];
 
         status->updateCancel(literal);
@@ -78,6 +475,17 @@ void CosyManager::summarize() const {
     Printer::printStat("Variable Order", _order->variableModeString());
     Printer::printStat("Value Order", _order->valueModeString());
     Printer::printStat("Order", _order->preview());
+    if (numberOfRowStatuses() > 0)
+        Printer::printStat("Row swap statuses", numberOfRowStatuses());
+    if (numberOfStabilizerStatuses() > 0)
+        Printer::printStat("Stabilizer chain statuses",
+                           numberOfStabilizerStatuses());
+    if (_propagator)
+        Printer::printStat("Symmetry propagation", "enabled");
+    if (_check_period > 0)
+        Printer::printStat("Sleeping statuses", _num_sleeping);
+    if (_level_zero_simplification)
+        Printer::printStat("Level 0 simplification", "enabled");
 }
 
 
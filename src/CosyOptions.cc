@@ -0,0 +1,201 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/CosyOptions.h"
+
+#include <cstdlib>
+#include <sstream>
+
+#include "cosy/Logging.h"
+
+namespace cosy {
+
+namespace {
+
+bool parseBool(const std::string& value, bool *result) {
+    if (value == "1" || value == "true") {
+        *result = true;
+    } else if (value == "0" || value == "false") {
+        *result = false;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+template<typename T>
+bool parseUnsigned(const std::string& value, T *result) {
+    char *end = nullptr;
+    const int64 parsed = strtoll(value.c_str(), &end, 10);
+    if (value.empty() || *end != '\0' || parsed < 0)
+        return false;
+    *result = static_cast<T>(parsed);
+    return true;
+}
+
+const char* kOrderNames[] = { "increase", "occurence", "breakid", "auto",
+                              "dynamic" };
+const OrderMode kOrders[] = { INCREASE, OCCURENCE, BREAKID, AUTO, DYNAMIC };
+
+bool parseOrder(const std::string& value, OrderMode *result) {
+    for (unsigned int i = 0; i < sizeof(kOrders) / sizeof(kOrders[0]); i++) {
+        if (value == kOrderNames[i]) {
+            *result = kOrders[i];
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* orderName(OrderMode order) {
+    for (unsigned int i = 0; i < sizeof(kOrders) / sizeof(kOrders[0]); i++)
+        if (kOrders[i] == order)
+            return kOrderNames[i];
+    return "unknown";
+}
+
+const char* minimizationName(MinimizationMode mode) {
+    switch (mode) {
+    case LEVEL_ZERO_MINIMIZATION: return "level0";
+    case REASON_MINIMIZATION:     return "reasons";
+    default:                      return "none";
+    }
+}
+
+}  // namespace
+
+bool CosyOptions::parse(const std::string& spec) {
+    CosyOptions parsed(*this);
+
+    if (!parsed.apply(spec))
+        return false;
+    *this = parsed;
+    return true;
+}
+
+bool CosyOptions::apply(const std::string& spec) {
+    std::istringstream stream(spec);
+    std::string item;
+
+    while (std::getline(stream, item, ',')) {
+        if (item.empty())
+            continue;
+
+        const size_t equal = item.find('=');
+        const std::string name = item.substr(0, equal);
+        const std::string value = equal == std::string::npos ?
+            std::string("1") : item.substr(equal + 1);
+        bool success;
+
+        if (name == "esbp") {
+            success = parseBool(value, &esbp);
+        } else if (name == "esbp_forcing") {
+            success = parseBool(value, &esbp_forcing);
+        } else if (name == "max_esbp_size") {
+            success = parseUnsigned(value, &max_esbp_size);
+        } else if (name == "order") {
+            success = parseOrder(value, &order);
+        } else if (name == "value") {
+            success = true;
+            if (value == "true_less_false")
+                this->value = TRUE_LESS_FALSE;
+            else if (value == "false_less_true")
+                this->value = FALSE_LESS_TRUE;
+            else
+                success = false;
+        } else if (name == "finder") {
+            success = true;
+            if (value == "bliss")
+                finder = SymmetryFinder::BLISS;
+            else if (value == "saucy")
+                finder = SymmetryFinder::SAUCY;
+            else
+                success = false;
+        } else if (name == "max_stabilizer_statuses") {
+            success = parseUnsigned(value, &max_stabilizer_statuses);
+        } else if (name == "max_symmetric_images") {
+            success = parseUnsigned(value, &max_symmetric_images);
+        } else if (name == "sleep_check_period") {
+            success = parseUnsigned(value, &sleep_check_period);
+        } else if (name == "max_sleep") {
+            success = parseUnsigned(value, &max_sleep) && max_sleep > 0;
+        } else if (name == "level_zero_simplification") {
+            success = parseBool(value, &level_zero_simplification);
+        } else if (name == "max_esbp_per_literal") {
+            success = parseUnsigned(value, &max_esbp_per_literal) &&
+                max_esbp_per_literal > 0;
+        } else if (name == "esbp_selection") {
+            success = true;
+            if (value == "shortest")
+                esbp_selection = SHORTEST_ESBP;
+            else if (value == "lowest_level")
+                esbp_selection = LOWEST_LEVEL_ESBP;
+            else
+                success = false;
+        } else if (name == "esbp_minimization") {
+            success = true;
+            if (value == "none")
+                esbp_minimization = NO_MINIMIZATION;
+            else if (value == "level0")
+                esbp_minimization = LEVEL_ZERO_MINIMIZATION;
+            else if (value == "reasons")
+                esbp_minimization = REASON_MINIMIZATION;
+            else
+                success = false;
+        } else if (name == "esbp_cache_size") {
+            success = parseUnsigned(value, &esbp_cache_size);
+        } else if (name == "row_interchangeability") {
+            success = parseBool(value, &row_interchangeability);
+        } else if (name == "symmetry_propagation") {
+            success = parseBool(value, &symmetry_propagation);
+        } else if (name == "symmetric_learning") {
+            success = parseBool(value, &symmetric_learning);
+        } else if (name == "symmetric_polarity") {
+            success = parseBool(value, &symmetric_polarity);
+        } else {
+            LOG(ERROR) << "Unknown cosy option " << name;
+            return false;
+        }
+
+        if (!success) {
+            LOG(ERROR) << "Bad value " << value << " for cosy option " << name;
+            return false;
+        }
+    }
+    return true;
+}
+
+std::string CosyOptions::toString() const {
+    std::ostringstream out;
+
+    out << "esbp=" << esbp
+        << ",esbp_forcing=" << esbp_forcing
+        << ",max_esbp_size=" << max_esbp_size
+        << ",order=" << orderName(order)
+        << ",value=" << (value == TRUE_LESS_FALSE ? "true_less_false" :
+                         "false_less_true")
+        << ",finder=" << (finder == SymmetryFinder::BLISS ? "bliss" : "saucy")
+        << ",max_stabilizer_statuses=" << max_stabilizer_statuses
+        << ",max_symmetric_images=" << max_symmetric_images
+        << ",sleep_check_period=" << sleep_check_period
+        << ",max_sleep=" << max_sleep
+        << ",level_zero_simplification=" << level_zero_simplification
+        << ",max_esbp_per_literal=" << max_esbp_per_literal
+        << ",esbp_selection=" << (esbp_selection == SHORTEST_ESBP ?
+                                  "shortest" : "lowest_level")
+        << ",esbp_minimization=" << minimizationName(esbp_minimization)
+        << ",esbp_cache_size=" << esbp_cache_size
+        << ",row_interchangeability=" << row_interchangeability
+        << ",symmetry_propagation=" << symmetry_propagation
+        << ",symmetric_learning=" << symmetric_learning
+        << ",symmetric_polarity=" << symmetric_polarity;
+    return out.str();
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -2,6 +2,8 @@
 
 #include "cosy/CosyStatus.h"
 
+#include <algorithm>
+
 namespace cosy {
 
 CosyStatus::CosyStatus(const Permutation &permutation, const Order &order,
@@ -10,7 +12,10 @@ CosyStatus::CosyStatus(const Permutation &permutation, const Order &order,
     _order(order),
     _assignment(assignment),
     _lookup_index(0),
-    _state(ACTIVE) {
+    _state(ACTIVE),
+    _num_esbp(0),
+    _num_forcing_esbp(0),
+    _num_updates(0) {
 }
 
 CosyStatus::~CosyStatus() {
@@ -20,15 +25,68 @@ void CosyStatus::addLookupLiteral(const Literal& literal) {
     _lookup_order.push_back(literal);
 }
 
-void CosyStatus::generateUnitClauseOnInverting(ClauseInjector *injector) {
+void CosyStatus::clearLookupOrder() {
+    _lookup_order.clear();
+    reset();
+}
+
+void CosyStatus::reset() {
+    Literal element, inverse;
+
+    _lookup_infos.clear();
+    for (_lookup_index = 0; _lookup_index < _lookup_order.size();
+         ++_lookup_index) {
+        element = _lookup_order[_lookup_index];
+        inverse = _permutation.inverseOf(element);
+
+        if (!_assignment.hasSameAssignmentValue(element, inverse))
+            break;
+    }
+    updateState();
+}
+
+bool CosyStatus::isSettled() const {
     if (isLookupEnd())
-        return;
+        return true;
+
+    const Literal element = _lookup_order[_lookup_index];
+    const Literal inverse = _permutation.inverseOf(element);
+    return _assignment.bothLiteralsAreAssigned(element, inverse);
+}
+
+void CosyStatus::compactLookupOrder() {
+    std::vector<Literal> compacted;
+    Literal element, inverse, fixed;
+    bool has_fixed = false;
+
+    for (unsigned int i = 0; i < _lookup_order.size(); i++) {
+        element = _lookup_order[i];
+        inverse = _permutation.inverseOf(element);
+
+        if (_assignment.hasSameAssignmentValue(element, inverse)) {
+            fixed = element;
+            has_fixed = true;
+            continue;
+        }
+        // The ESBP of an inverting pair has a single variable, a fixed pair
+        // is kept in front of it for the second literal.
+        if (compacted.empty() && has_fixed && element == inverse.negated())
+            compacted.push_back(fixed);
+        compacted.push_back(element);
+    }
+    _lookup_order.swap(compacted);
+    reset();
+}
+
+bool CosyStatus::generateUnitClauseOnInverting(ClauseInjector *injector) {
+    if (isLookupEnd())
+        return false;
 
     const Literal element = _lookup_order[_lookup_index];
     const Literal inverse = _permutation.inverseOf(element);
 
     if (element != inverse.negated())
-        return;
+        return false;
 
     BooleanVariable variable = element.variable();
     Literal unit = Literal(variable, _order.valueMode() == TRUE_LESS_FALSE);
@@ -37,6 +95,7 @@ void CosyStatus::generateUnitClauseOnInverting(ClauseInjector *injector) {
 
     injector->addClause(ClauseInjector::Type::UNITS, kNoBooleanVariable,
                         std::move(literals));
+    return true;
 }
 
 void CosyStatus::updateNotify(const Literal& literal) {
@@ -44,6 +103,7 @@ void CosyStatus::updateNotify(const Literal& literal) {
     Literal element, inverse;
     const BooleanVariable variable = literal.variable();
 
+    _num_updates++;
     for (; _lookup_index < _lookup_order.size(); ++_lookup_index) {
         element = _lookup_order[_lookup_index];
         inverse = _permutation.inverseOf(element);
@@ -104,6 +164,44 @@ void CosyStatus::updateState() {
     }
 }
 
+bool CosyStatus::suggestLiteral(BooleanVariable variable,
+                                Literal *literal) const {
+    if (isLookupEnd() || _state == INACTIVE || _state == REDUCER)
+        return false;
+
+    const Literal element = _lookup_order[_lookup_index];
+    const Literal inverse = _permutation.inverseOf(element);
+    const Literal minimal = _order.leq(element, inverse);
+    const Literal maximal = minimal == element ? inverse : element;
+
+    if (minimal.variable() == variable) {
+        *literal = _order.minimalValueLiteral(minimal);
+    } else if (maximal.variable() != variable) {
+        return false;
+    } else if (_assignment.literalIsAssigned(minimal)) {
+        *literal = _assignment.literalIsTrue(minimal) ? maximal :
+            maximal.negated();
+    } else {
+        *literal = _order.minimalValueLiteral(maximal).negated();
+    }
+    return true;
+}
+
+unsigned int
+CosyStatus::esbpLevel(const std::vector<unsigned int>& levels) const {
+    unsigned int level = 0;
+    Literal element, inverse;
+
+    DCHECK(!isLookupEnd());
+    for (unsigned int i = 0; i <= _lookup_index; i++) {
+        element = _lookup_order[i];
+        inverse = _permutation.inverseOf(element);
+        level = std::max(level, levels[element.variable().value()]);
+        level = std::max(level, levels[inverse.variable().value()]);
+    }
+    return level;
+}
+
 void
 CosyStatus::generateESBP(BooleanVariable reason, ClauseInjector *injector) {
     std::vector<Literal> literals;
@@ -132,9 +230,13 @@ CosyStatus::generateESBP(BooleanVariable reason, ClauseInjector *injector) {
             literals.push_back(l);
     }
 
-    DCHECK_GE(literals.size(), 2);
-    std::swap(literals[0], literals[1]);
+    // A single literal when the inverting element is the first one of a
+    // DYNAMIC order: static orders give it as a unit before the search.
+    DCHECK_GE(literals.size(), 1);
+    if (literals.size() > 1)
+        std::swap(literals[0], literals[1]);
 
+    _num_esbp++;
     injector->addClause(ClauseInjector::Type::ESBP, reason,
                         std::move(literals));
 }
@@ -180,6 +282,7 @@ void CosyStatus::generateForceLexLeaderESBP(BooleanVariable reason,
             literals.push_back(l);
     }
 
+    _num_forcing_esbp++;
     injector->addClause(ClauseInjector::Type::ESBP_FORCING,
                         reason, std::move(literals));
 }
@@ -0,0 +1,30 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/DreadnautReader.h"
+
+namespace cosy {
+
+bool DreadnautReader::toSignedLiteral(int node, unsigned int num_vars,
+                                      int *literal) const {
+    const int n = num_vars;
+
+    if (node < 0)
+        return false;
+
+    if (node < n)
+        *literal = node + 1;
+    else if (node < 2 * n)
+        *literal = -(node - n + 1);
+    else
+        *literal = 0;  // represent clause
+    return true;
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
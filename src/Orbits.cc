@@ -2,45 +2,57 @@
 
 #include "cosy/Orbits.h"
 
-namespace cosy {
+#include <algorithm>
 
-void Orbits::assign(const std::vector<Permutation*> permutations) {
-    std::unordered_set<BooleanVariable> used;
-    DisjointSets disjointSets;
-    int e, i;
+namespace cosy {
 
+void Orbits::assign(const std::vector<Permutation*>& permutations) {
+    _sets.clear();
     _symmetrics.clear();
-    _orbits.clear();
 
     for (const Permutation* permutation : permutations) {
+        _sets.reserve(permutation->size());
         for (unsigned int c = 0; c < permutation->numberOfCycles(); ++c) {
-            Literal element = permutation->lastElementInCycle(c);
-            e = element.variable().value();
-            disjointSets.Add(e);
+            const int e = permutation->lastElementInCycle(c).variable().value();
+            if (!_sets.contains(e)) {
+                _sets.Add(e);
+                _symmetrics.push_back(BooleanVariable(e));
+            }
 
             for (const Literal& image : permutation->cycle(c)) {
-                i = image.variable().value();
+                const int i = image.variable().value();
+                if (!_sets.contains(i)) {
+                    _sets.Add(i);
+                    _symmetrics.push_back(image.variable());
+                }
+                _sets.Union(e, i);
+            }
+        }
+    }
 
-                if (used.insert(element.variable()).second)
-                    _symmetrics.push_back(element.variable());
+    // Visiting variables increasingly numbers orbits by their smallest
+    // variable and fills each orbit in increasing order.
+    std::sort(_symmetrics.begin(), _symmetrics.end());
 
-                disjointSets.Add(i);
-                disjointSets.Union(e, i);
+    _orbit_of_root.resize(_sets.capacity());
+    for (const BooleanVariable& variable : _symmetrics)
+        _orbit_of_root[_sets.Find(variable.value())] = -1;
 
-                element = image;
-                e = element.variable().value();
-            }
+    _offsets.assign(1, 0);
+    for (const BooleanVariable& variable : _symmetrics) {
+        const int root = _sets.Find(variable.value());
+        if (_orbit_of_root[root] < 0) {
+            _orbit_of_root[root] = _offsets.size() - 1;
+            _offsets.push_back(_offsets.back() + _sets.setSize(root));
         }
     }
 
-    std::unordered_map<int, std::vector<BooleanVariable>> m_orbits;
+    _fill.assign(_offsets.begin(), _offsets.end() - 1);
+    _members.resize(_symmetrics.size());
     for (const BooleanVariable& variable : _symmetrics) {
-        int representant = disjointSets.Find(variable.value());
-        m_orbits[representant].push_back(variable);
+        const int orbit = _orbit_of_root[_sets.Find(variable.value())];
+        _members[_fill[orbit]++] = variable;
     }
-
-    for (const auto& orbit : m_orbits)
-        _orbits.emplace_back(std::move(orbit.second));
 }
 
 }  // namespace cosy
@@ -32,8 +32,15 @@ bool Order::contains(const Literal& literal) const {
 
 const Literal Order::leq(const Literal& a, const Literal& b) const {
     // <= is really important, on inverting -1, 1 we must return
-    // the positive value because our order is only positive element
-    return _indexes.at(a) <= _indexes.at(b) ? a : b;
+    // the positive value because our order is only positive element.
+    // Literals outside the order come last (see DynamicOrder).
+    const auto index_a = _indexes.find(a);
+    const auto index_b = _indexes.find(b);
+    if (index_b == _indexes.end())
+        return a;
+    if (index_a == _indexes.end())
+        return b;
+    return index_a->second <= index_b->second ? a : b;
 }
 
 bool
@@ -75,6 +82,209 @@ std::string Order::valueModeString() const {
     return std::string("UNKNOWN");
 }
 
+/*----------------------------------------------------------------------------*/
+
+BreakIDOrder::BreakIDOrder(int64 num_vars, ValueMode mode,
+                           const Group& group) :
+    Order(num_vars, mode),
+    _orbits(num_vars),
+    _orbit_of(num_vars, kNoBooleanVariable),
+    _occurences(num_vars, 0),
+    _num_leaves(1) {
+    const std::vector< std::unique_ptr<Permutation> >& permutations =
+        group.permutations();
+    const int64 num_permutations = permutations.size();
+    std::vector<Permutation*> touched;
+    std::vector<bool> removed(num_permutations, false);
+    std::vector<int64> stamp(num_permutations, -1);
+    std::vector<BooleanVariable> affected;
+    std::vector<int> var_offsets(num_vars + 1, 0);
+    std::vector<int> var_permutations;
+    int64 num_remaining = num_permutations;
+    Orbits orbits;
+
+    while (_num_leaves < num_vars)
+        _num_leaves *= 2;
+    _tree_size.assign(2 * _num_leaves, 0);
+    _tree_best.assign(2 * _num_leaves, kNoBooleanVariable);
+
+    // Permutations moving each variable, in CSR form
+    for (const std::unique_ptr<Permutation>& perm : permutations)
+        for (const Literal& literal : perm->support())
+            var_offsets[literal.variable().value() + 1]++;
+    for (int64 v = 0; v < num_vars; v++)
+        var_offsets[v + 1] += var_offsets[v];
+    var_permutations.resize(var_offsets[num_vars]);
+    {
+        std::vector<int> fill(var_offsets.begin(), var_offsets.end() - 1);
+        for (int64 p = 0; p < num_permutations; p++) {
+            for (const Literal& literal : permutations[p]->support()) {
+                const int v = literal.variable().value();
+                var_permutations[fill[v]++] = p;
+                if (literal.isPositive())
+                    _occurences[v]++;
+            }
+        }
+    }
+
+    for (const std::unique_ptr<Permutation>& perm : permutations)
+        touched.push_back(perm.get());
+    orbits.assign(touched);
+    addOrbits(orbits);
+
+    for (int64 step = 0; num_remaining > 0; step++) {
+        const BooleanVariable next = selectNext();
+
+        if (next == kNoBooleanVariable) {
+            LOG(ERROR) << "Problem with generators ??";
+            break;
+        }
+
+        add(Literal(next, true));
+
+        // Remove permutations containing next, only their orbits change
+        affected.clear();
+        const Literal next_literal = Literal(next, true);
+        for (int i = var_offsets[next.value()];
+             i < var_offsets[next.value() + 1]; i++) {
+            const int p = var_permutations[i];
+            if (removed[p] || permutations[p]->isTrivialImage(next_literal))
+                continue;
+            removed[p] = true;
+            num_remaining--;
+            for (const Literal& literal : permutations[p]->support()) {
+                const BooleanVariable variable = literal.variable();
+                if (literal.isPositive())
+                    _occurences[variable.value()]--;
+                if (_orbit_of[variable.value()] != kNoBooleanVariable)
+                    affected.push_back(_orbit_of[variable.value()]);
+            }
+        }
+
+        std::sort(affected.begin(), affected.end());
+        affected.erase(std::unique(affected.begin(), affected.end()),
+                       affected.end());
+
+        // Remaining permutations of the affected orbits
+        touched.clear();
+        for (const BooleanVariable& representative : affected) {
+            OrbitSummary& orbit = _orbits[representative.value()];
+            for (const BooleanVariable& variable : orbit.members) {
+                _orbit_of[variable.value()] = kNoBooleanVariable;
+                for (int i = var_offsets[variable.value()];
+                     i < var_offsets[variable.value() + 1]; i++) {
+                    const int p = var_permutations[i];
+                    if (removed[p] || stamp[p] == step)
+                        continue;
+                    stamp[p] = step;
+                    touched.push_back(permutations[p].get());
+                }
+            }
+            orbit.members.clear();
+            orbit.best = kNoBooleanVariable;
+            updateTree(representative);
+        }
+
+        orbits.assign(touched);
+        addOrbits(orbits);
+    }
+
+    // Complete order
+    for (BooleanVariable var(0); var < num_vars; ++var) {
+        const Literal literal(var, true);
+        if (!contains(literal))
+            add(literal);
+    }
+
+    _orbits.clear();
+    _orbit_of.clear();
+    _occurences.clear();
+    _tree_size.clear();
+    _tree_best.clear();
+}
+
+void BreakIDOrder::addOrbits(const Orbits& orbits) {
+    for (const Orbits::Orbit orbit : orbits) {
+        const BooleanVariable representative = *orbit.begin();
+
+        // Touched permutations may also have cycles in unaffected orbits
+        if (_orbit_of[representative.value()] != kNoBooleanVariable)
+            continue;
+
+        OrbitSummary& summary = _orbits[representative.value()];
+        summary.members.assign(orbit.begin(), orbit.end());
+        summary.best = kNoBooleanVariable;
+        for (const BooleanVariable& variable : orbit) {
+            _orbit_of[variable.value()] = representative;
+            if (_occurences[variable.value()] == 0)
+                continue;
+            if (summary.best == kNoBooleanVariable ||
+                isBetter(variable, summary.best))
+                summary.best = variable;
+        }
+        updateTree(representative);
+    }
+}
+
+void BreakIDOrder::updateTree(BooleanVariable representative) {
+    const OrbitSummary& orbit = _orbits[representative.value()];
+    int64 node = _num_leaves + representative.value();
+
+    _tree_size[node] = orbit.members.size();
+    _tree_best[node] = orbit.best;
+    for (node /= 2; node > 0; node /= 2) {
+        const BooleanVariable left = _tree_best[2 * node];
+        const BooleanVariable right = _tree_best[2 * node + 1];
+
+        _tree_size[node] = std::max(_tree_size[2 * node],
+                                    _tree_size[2 * node + 1]);
+        _tree_best[node] = left == kNoBooleanVariable ||
+            (right != kNoBooleanVariable && isBetter(right, left)) ?
+            right : left;
+    }
+}
+
+int64 BreakIDOrder::findCandidate(int64 node, int64 first, int64 last,
+                                  int64 from, unsigned int min_size,
+                                  BooleanVariable champion) const {
+    const BooleanVariable best = _tree_best[node];
+
+    if (last < from || _tree_size[node] < min_size ||
+        best == kNoBooleanVariable ||
+        (champion != kNoBooleanVariable && !isBetter(best, champion)))
+        return -1;
+
+    if (first == last)
+        return first;
+
+    const int64 middle = (first + last) / 2;
+    const int64 left = findCandidate(2 * node, first, middle, from, min_size,
+                                     champion);
+    if (left >= 0)
+        return left;
+    return findCandidate(2 * node + 1, middle + 1, last, from, min_size,
+                         champion);
+}
+
+BooleanVariable BreakIDOrder::selectNext() const {
+    // Visit orbits by representative and keep the variable with less
+    // occurences, skipping orbits smaller than the one of the current
+    // champion. The tree jumps directly to the next orbit that can win.
+    BooleanVariable next = kNoBooleanVariable;
+    unsigned int largestOrbit = 0;
+    int64 from = 0;
+
+    while (true) {
+        const int64 representative = findCandidate(1, 0, _num_leaves - 1,
+                                                   from, largestOrbit, next);
+        if (representative < 0)
+            break;
+        next = _orbits[representative].best;
+        largestOrbit = _orbits[representative].members.size();
+        from = representative + 1;
+    }
+    return next;
+}
 
 }  // namespace cosy
 
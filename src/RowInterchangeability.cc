@@ -0,0 +1,174 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/RowInterchangeability.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace cosy {
+
+RowInterchangeability::RowInterchangeability(unsigned int num_vars) :
+    _num_vars(num_vars),
+    _row_of(num_vars, -1),
+    _column_of(num_vars, -1) {
+}
+
+int64 RowInterchangeability::numberOfCovered() const {
+    return std::count(_covered.begin(), _covered.end(), true);
+}
+
+void RowInterchangeability::detect(const Group& group) {
+    const int64 num_generators = group.numberOfPermutations();
+    std::vector<Transpositions> transpositions(num_generators);
+    std::vector<bool> candidate(num_generators, false);
+
+    _matrices.clear();
+    _covered.assign(num_generators, false);
+
+    for (int64 i = 0; i < num_generators; i++)
+        candidate[i] = isCandidate(*group.permutations()[i],
+                                   &transpositions[i]);
+
+    for (int64 i = 0; i < num_generators; i++) {
+        if (!candidate[i] || _covered[i])
+            continue;
+
+        std::unique_ptr<LiteralMatrix> matrix(new LiteralMatrix());
+        std::vector<Literal> left, right;
+        for (const std::pair<Literal, Literal>& t : transpositions[i]) {
+            left.push_back(t.first);
+            right.push_back(t.second);
+        }
+        matrix->addRow(std::move(left));
+        matrix->addRow(std::move(right));
+        placeRow(*matrix, 0);
+        placeRow(*matrix, 1);
+        _covered[i] = true;
+
+        bool changed = true;
+        while (changed) {
+            changed = false;
+            for (int64 j = i + 1; j < num_generators; j++) {
+                if (!candidate[j] || _covered[j])
+                    continue;
+                if (swapsRows(transpositions[j], *matrix)) {
+                    _covered[j] = true;
+                } else if (extendsMatrix(transpositions[j], matrix.get())) {
+                    _covered[j] = true;
+                    changed = true;
+                }
+            }
+        }
+
+        // Release positions for the next matrix
+        for (unsigned int r = 0; r < matrix->numberOfRows(); r++) {
+            for (const Literal& literal : matrix->row(r)) {
+                _row_of[literal.variable().value()] = -1;
+                _column_of[literal.variable().value()] = -1;
+            }
+        }
+        _matrices.emplace_back(matrix.release());
+    }
+}
+
+bool RowInterchangeability::isCandidate(const Permutation& permutation,
+                                        Transpositions *transpositions) const {
+    transpositions->clear();
+
+    for (unsigned int c = 0; c < permutation.numberOfCycles(); ++c) {
+        const Permutation::Iterator cycle = permutation.cycle(c);
+        if (cycle.size() != 2)
+            return false;
+
+        const Literal a = *cycle.begin();
+        const Literal b = *(cycle.begin() + 1);
+        if (a.isPositive() != b.isPositive())
+            return false;  // Inverting or mixed sign transposition
+        if (a.isPositive())
+            transpositions->push_back(std::make_pair(a, b));
+    }
+    return !transpositions->empty();
+}
+
+bool RowInterchangeability::swapsRows(const Transpositions& transpositions,
+                                      const LiteralMatrix& matrix) const {
+    if (transpositions.size() != matrix.numberOfColumns())
+        return false;
+
+    int first = -1, second = -1;
+    std::vector<bool> column_seen(matrix.numberOfColumns(), false);
+
+    for (const std::pair<Literal, Literal>& t : transpositions) {
+        const int va = t.first.variable().value();
+        const int vb = t.second.variable().value();
+        int ra = _row_of[va], rb = _row_of[vb];
+
+        if (ra < 0 || rb < 0 || ra == rb ||
+            _column_of[va] != _column_of[vb] || column_seen[_column_of[va]])
+            return false;
+        column_seen[_column_of[va]] = true;
+
+        if (ra > rb)
+            std::swap(ra, rb);
+        if (first < 0) {
+            first = ra;
+            second = rb;
+        } else if (first != ra || second != rb) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RowInterchangeability::extendsMatrix(const Transpositions& transpositions,
+                                          LiteralMatrix *matrix) {
+    const unsigned int num_columns = matrix->numberOfColumns();
+    if (transpositions.size() != num_columns)
+        return false;
+
+    int row = -1;
+    std::vector<Literal> new_row(num_columns);
+    std::vector<bool> column_seen(num_columns, false);
+
+    for (const std::pair<Literal, Literal>& t : transpositions) {
+        Literal inside = t.first, outside = t.second;
+        if (_row_of[inside.variable().value()] < 0)
+            std::swap(inside, outside);
+
+        const int vi = inside.variable().value();
+        const int vo = outside.variable().value();
+        if (_row_of[vi] < 0 || _row_of[vo] >= 0)
+            return false;
+        if (row >= 0 && _row_of[vi] != row)
+            return false;
+        row = _row_of[vi];
+
+        const int column = _column_of[vi];
+        if (column_seen[column])
+            return false;
+        column_seen[column] = true;
+        new_row[column] = outside;
+    }
+
+    matrix->addRow(std::move(new_row));
+    placeRow(*matrix, matrix->numberOfRows() - 1);
+    return true;
+}
+
+void RowInterchangeability::placeRow(const LiteralMatrix& matrix,
+                                     unsigned int row) {
+    const std::vector<Literal>& literals = matrix.row(row);
+    for (unsigned int c = 0; c < literals.size(); c++) {
+        _row_of[literals[c].variable().value()] = row;
+        _column_of[literals[c].variable().value()] = c;
+    }
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
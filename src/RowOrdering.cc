@@ -0,0 +1,53 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/RowOrdering.h"
+
+#include <algorithm>
+
+namespace cosy {
+
+RowOrdering::RowOrdering(const LiteralMatrix& matrix, const Order& order,
+                         unsigned int num_vars) {
+    const unsigned int num_rows = matrix.numberOfRows();
+    std::vector<Literal> first(num_rows);
+    std::vector<unsigned int> rows(num_rows);
+
+    auto before = [&order](const Literal& a, const Literal& b) {
+        return order.leq(a, b) == a && order.leq(b, a) == a;
+    };
+
+    for (unsigned int r = 0; r < num_rows; r++) {
+        const std::vector<Literal>& row = matrix.row(r);
+        first[r] = *std::min_element(row.begin(), row.end(), before);
+        rows[r] = r;
+    }
+    std::sort(rows.begin(), rows.end(),
+              [&](unsigned int a, unsigned int b) {
+                  return before(first[a], first[b]);
+              });
+
+    for (unsigned int i = 0; i + 1 < num_rows; i++) {
+        const std::vector<Literal>& upper = matrix.row(rows[i]);
+        const std::vector<Literal>& lower = matrix.row(rows[i + 1]);
+        std::unique_ptr<Permutation> swap(new Permutation(num_vars));
+
+        for (unsigned int c = 0; c < upper.size(); c++) {
+            swap->addToCurrentCycle(upper[c]);
+            swap->addToCurrentCycle(lower[c]);
+            swap->closeCurrentCycle();
+            swap->addToCurrentCycle(upper[c].negated());
+            swap->addToCurrentCycle(lower[c].negated());
+            swap->closeCurrentCycle();
+        }
+        _swaps.emplace_back(swap.release());
+    }
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
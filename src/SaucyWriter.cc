@@ -0,0 +1,41 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/SaucyWriter.h"
+
+namespace cosy {
+
+void SaucyWriter::writeHeader(unsigned int /*num_vars*/,
+                              const Group& /*group*/, StreamWriter *out) {
+    out->writeString("[\n");
+}
+
+void SaucyWriter::writeGenerator(unsigned int num_vars,
+                                 const Permutation& generator, bool last,
+                                 StreamWriter *out) {
+    const int64 n = num_vars;
+
+    for (unsigned int c = 0; c < generator.numberOfCycles(); ++c) {
+        char separator = '(';
+        for (const Literal& element : generator.cycle(c)) {
+            const int64 var = element.variable().value() + 1;
+            out->writeChar(separator);
+            out->writeInt(element.isPositive() ? var : n + var);
+            separator = ',';
+        }
+        out->writeChar(')');
+    }
+    out->writeString(last ? "\n" : ",\n");
+}
+
+void SaucyWriter::writeFooter(StreamWriter *out) {
+    out->writeString("]\n");
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
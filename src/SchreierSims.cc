@@ -0,0 +1,308 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/SchreierSims.h"
+
+#include <utility>
+
+#include "cosy/Printer.h"
+
+namespace cosy {
+
+SchreierSims::SchreierSims(const Group& group, unsigned int num_vars) :
+    _num_vars(num_vars),
+    _point_of(2 * num_vars, -1),
+    _complete(false) {
+    // Relabel moved literals into a compact domain
+    for (const std::unique_ptr<Permutation>& perm : group.permutations()) {
+        for (const Literal& literal : perm->support()) {
+            int& point = _point_of[literal.index().value()];
+            if (point < 0) {
+                point = _points.size();
+                _points.push_back(literal);
+            }
+        }
+    }
+
+    const unsigned int num_points = _points.size();
+    for (const std::unique_ptr<Permutation>& perm : group.permutations()) {
+        DensePermutation generator(num_points);
+        for (const Literal& literal : perm->support()) {
+            const Literal image = perm->imageOf(literal);
+            generator.setImage(_point_of[literal.index().value()],
+                               _point_of[image.index().value()]);
+        }
+        if (!generator.isIdentity())
+            _generators.push_back(std::move(generator));
+    }
+}
+
+bool SchreierSims::compute(const std::vector<Literal>& base_hint,
+                           const Budget& budget) {
+    _base.clear();
+    _strong.clear();
+    _strong_inverse.clear();
+    _levels.clear();
+    _complete = false;
+    _rng.seed(budget.seed);
+
+    _base_hint.clear();
+    for (const Literal& literal : base_hint) {
+        const int index = literal.index().value();
+        const int point = index < static_cast<int>(_point_of.size()) ?
+            _point_of[index] : -1;
+        if (point >= 0)
+            _base_hint.push_back(point);
+    }
+
+    const int64 num_points = _points.size();
+    if (num_points * static_cast<int64>(_generators.size() + 1) * 2 >
+        budget.max_elements)
+        return false;
+
+    for (const DensePermutation& generator : _generators) {
+        int level = 0;
+        while (level < static_cast<int>(_base.size()) &&
+               generator[_base[level]] == _base[level])
+            level++;
+        addStrongGenerator(generator, level);
+    }
+
+    if (_generators.empty()) {
+        _complete = true;
+        return true;
+    }
+
+    initRandomElements();
+
+    int64 num_sifts = 0;
+    int consecutive = 0;
+    while (consecutive < budget.confidence) {
+        if (num_sifts++ >= budget.max_sifts ||
+            numberOfElements() > budget.max_elements)
+            return false;
+
+        _scratch = nextRandomElement();
+        const int level = sift(&_scratch);
+        if (level == static_cast<int>(_base.size()) && _scratch.isIdentity()) {
+            consecutive++;
+            continue;
+        }
+
+        consecutive = 0;
+        addStrongGenerator(_scratch, level);
+    }
+
+    _complete = true;
+    return true;
+}
+
+int64 SchreierSims::numberOfElements() const {
+    const int64 num_points = _points.size();
+    return num_points * (2 * _strong.size() + _levels.size() +
+                         _random_pool.size() + 2);
+}
+
+int SchreierSims::chooseBasePoint(const DensePermutation& permutation) const {
+    for (const int point : _base_hint)
+        if (permutation[point] != point)
+            return point;
+    return permutation.firstMovedPoint();
+}
+
+void SchreierSims::addStrongGenerator(const DensePermutation& permutation,
+                                      int level) {
+    // The permutation fixes the whole base: extend it with a moved point
+    if (level == static_cast<int>(_base.size())) {
+        _base.push_back(chooseBasePoint(permutation));
+        _levels.push_back(Level());
+        _levels.back().schreier.assign(_points.size(), -1);
+    }
+
+    const int index = _strong.size();
+    _strong.push_back(permutation);
+    _strong_inverse.push_back(DensePermutation());
+    _strong_inverse.back().invert(permutation);
+
+    for (int i = 0; i <= level; i++) {
+        _levels[i].generators.push_back(index);
+        computeOrbit(i);
+    }
+}
+
+void SchreierSims::computeOrbit(unsigned int level) {
+    Level& data = _levels[level];
+    const int root = _base[level];
+
+    for (const int point : data.orbit)
+        data.schreier[point] = -1;
+    data.orbit.clear();
+
+    data.schreier[root] = -2;
+    data.orbit.push_back(root);
+    for (unsigned int i = 0; i < data.orbit.size(); i++) {
+        const int point = data.orbit[i];
+        for (const int g : data.generators) {
+            const int image = _strong[g][point];
+            if (data.schreier[image] == -1) {
+                data.schreier[image] = g;
+                data.orbit.push_back(image);
+            }
+        }
+    }
+}
+
+int SchreierSims::sift(DensePermutation *permutation) {
+    DensePermutation product;
+
+    for (unsigned int level = 0; level < _base.size(); level++) {
+        const Level& data = _levels[level];
+        const int root = _base[level];
+        int point = (*permutation)[root];
+
+        if (data.schreier[point] == -1)
+            return level;
+
+        // Walk back to the root, dividing by the labels on the way
+        while (point != root) {
+            const DensePermutation& inverse =
+                _strong_inverse[data.schreier[point]];
+            product.compose(inverse, *permutation);
+            std::swap(product, *permutation);
+            point = inverse[point];
+        }
+    }
+    return _base.size();
+}
+
+void SchreierSims::initRandomElements() {
+    const unsigned int kPoolSize = 10;
+    const int kWarmup = 50;
+
+    _random_pool.clear();
+    for (unsigned int i = 0; _random_pool.size() < kPoolSize ||
+             i < _generators.size(); i++)
+        _random_pool.push_back(_generators[i % _generators.size()]);
+
+    _random_element = DensePermutation(_points.size());
+    for (int i = 0; i < kWarmup; i++)
+        nextRandomElement();
+}
+
+const DensePermutation& SchreierSims::nextRandomElement() {
+    // Product replacement with an accumulator ("rattle")
+    const unsigned int size = _random_pool.size();
+    const unsigned int i = _rng() % size;
+    const unsigned int j = (i + 1 + _rng() % (size - 1)) % size;
+    DensePermutation product;
+
+    product.compose(_random_pool[i], _random_pool[j]);
+    std::swap(_random_pool[i], product);
+    product.compose(_random_element, _random_pool[i]);
+    std::swap(_random_element, product);
+
+    return _random_element;
+}
+
+std::vector<Literal> SchreierSims::base() const {
+    std::vector<Literal> literals;
+    for (const int point : _base)
+        literals.push_back(_points[point]);
+    return literals;
+}
+
+std::vector<Literal> SchreierSims::basicOrbit(unsigned int level) const {
+    std::vector<Literal> literals;
+    for (const int point : _levels[level].orbit)
+        literals.push_back(_points[point]);
+    return literals;
+}
+
+bool SchreierSims::inBasicOrbit(unsigned int level, Literal literal) const {
+    const int index = literal.index().value();
+    if (index >= static_cast<int>(_point_of.size()))
+        return false;
+    const int point = _point_of[index];
+    return point >= 0 && _levels[level].schreier[point] != -1;
+}
+
+BigUnsigned SchreierSims::order() const {
+    BigUnsigned result(1);
+    for (const Level& level : _levels)
+        result *= level.orbit.size();
+    return result;
+}
+
+bool SchreierSims::computeCosetRepresentative(
+    unsigned int level, Literal literal,
+    DensePermutation *representative) const {
+    if (!inBasicOrbit(level, literal))
+        return false;
+
+    const Level& data = _levels[level];
+    DensePermutation product;
+    int point = _point_of[literal.index().value()];
+
+    // point = s_1(s_2(...s_k(root))) so u = s_1 o s_2 o ... o s_k
+    *representative = DensePermutation(_points.size());
+    while (point != _base[level]) {
+        const int label = data.schreier[point];
+        product.compose(*representative, _strong[label]);
+        std::swap(product, *representative);
+        point = _strong_inverse[label][point];
+    }
+    return true;
+}
+
+std::unique_ptr<Permutation>
+SchreierSims::cosetRepresentative(unsigned int level, Literal literal) const {
+    DensePermutation representative;
+
+    if (!computeCosetRepresentative(level, literal, &representative))
+        return nullptr;
+    return toPermutation(representative);
+}
+
+std::unique_ptr<Permutation>
+SchreierSims::inverseCosetRepresentative(unsigned int level,
+                                         Literal literal) const {
+    DensePermutation representative, inverse;
+
+    if (!computeCosetRepresentative(level, literal, &representative))
+        return nullptr;
+    inverse.invert(representative);
+    return toPermutation(inverse);
+}
+
+std::unique_ptr<Permutation>
+SchreierSims::toPermutation(const DensePermutation& permutation) const {
+    std::unique_ptr<Permutation> result(new Permutation(_num_vars));
+    std::vector<bool> visited(permutation.size(), false);
+
+    for (unsigned int start = 0; start < permutation.size(); start++) {
+        if (visited[start] || permutation[start] == static_cast<int>(start))
+            continue;
+        for (int point = start; !visited[point]; point = permutation[point]) {
+            visited[point] = true;
+            result->addToCurrentCycle(_points[point]);
+        }
+        result->closeCurrentCycle();
+    }
+    return result;
+}
+
+void SchreierSims::summarize() const {
+    Printer::printStat("Group order", order().toString(),
+                       _complete ? "" : "(lower bound)");
+    Printer::printStat("Base size", static_cast<int64>(_base.size()));
+    Printer::printStat("Number of strong generators",
+                       numberOfStrongGenerators());
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
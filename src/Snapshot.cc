@@ -0,0 +1,343 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/Snapshot.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+namespace cosy {
+
+static_assert(sizeof(Literal) == sizeof(int32),
+              "Snapshot stores literals as their 32 bits index");
+
+namespace {
+
+int64 align(int64 offset) {
+    return (offset + 7) & ~static_cast<int64>(7);
+}
+
+// Offsets into the next section start at 0, never decrease and end at its
+// size.
+bool checkOffsets(const int64 *offsets, int64 count, int64 size) {
+    if (offsets[0] != 0 || offsets[count] != size)
+        return false;
+    for (int64 i = 0; i < count; i++)
+        if (offsets[i] > offsets[i + 1])
+            return false;
+    return true;
+}
+
+bool checkLiterals(const Literal *literals, int64 count, int64 num_vars) {
+    for (int64 i = 0; i < count; i++) {
+        const int64 index = literals[i].index().value();
+        if (index < 0 || index >= 2 * num_vars)
+            return false;
+    }
+    return true;
+}
+
+bool writeAt(FILE *out, int64 offset, const void *data, int64 size) {
+    if (size == 0)
+        return true;
+    if (fseek(out, offset, SEEK_SET) != 0)
+        return false;
+    return fwrite(data, 1, size, out) == static_cast<size_t>(size);
+}
+
+}  // namespace
+
+bool SnapshotWriter::write(const std::string& filename, const CNFModel& model,
+                           const Group& group) {
+    const int64 num_vars = model.numberOfVariables();
+    std::vector<int64> clause_offsets;
+    std::vector<int32> clause_literals;
+    std::vector<int64> occurences(3 * num_vars, 0);
+    std::vector<int64> permutation_offsets;
+    std::vector<int64> cycle_offsets;
+    std::vector<int32> cycle_literals;
+
+    clause_offsets.reserve(model.clauses().size() + 1);
+    clause_offsets.push_back(0);
+    for (const std::unique_ptr<Clause>& clause : model.clauses()) {
+        for (const Literal& literal : *clause)
+            clause_literals.push_back(literal.index().value());
+        clause_offsets.push_back(clause_literals.size());
+    }
+
+    const std::vector<int64>* per_kind[3] = { &model.positiveOccurences(),
+                                              &model.negativeOccurences(),
+                                              &model.occurences() };
+    for (int kind = 0; kind < 3; kind++) {
+        const std::vector<int64>& occ = *per_kind[kind];
+        for (unsigned int i = 0; i < occ.size() && i < num_vars; i++)
+            occurences[kind * num_vars + i] = occ[i];
+    }
+
+    permutation_offsets.push_back(0);
+    cycle_offsets.push_back(0);
+    for (const std::unique_ptr<Permutation>& perm : group.permutations()) {
+        for (unsigned int c = 0; c < perm->numberOfCycles(); ++c) {
+            for (const Literal& literal : perm->cycle(c))
+                cycle_literals.push_back(literal.index().value());
+            cycle_offsets.push_back(cycle_literals.size());
+        }
+        permutation_offsets.push_back(cycle_offsets.size() - 1);
+    }
+
+    SnapshotHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, kSnapshotMagic, sizeof(kSnapshotMagic));
+    header.version = kSnapshotVersion;
+    header.header_size = sizeof(SnapshotHeader);
+    header.num_variables = num_vars;
+    header.num_clauses = model.numberOfClauses();
+    header.num_stored_clauses = model.clauses().size();
+    header.num_clause_literals = clause_literals.size();
+    header.num_permutations = group.numberOfPermutations();
+    header.num_cycles = cycle_offsets.size() - 1;
+    header.num_cycle_literals = cycle_literals.size();
+
+    int64 offset = align(sizeof(SnapshotHeader));
+    header.clause_offsets = offset;
+    offset = align(offset + clause_offsets.size() * sizeof(int64));
+    header.clause_literals = offset;
+    offset = align(offset + clause_literals.size() * sizeof(int32));
+    header.occurences = offset;
+    offset = align(offset + occurences.size() * sizeof(int64));
+    header.permutation_offsets = offset;
+    offset = align(offset + permutation_offsets.size() * sizeof(int64));
+    header.cycle_offsets = offset;
+    offset = align(offset + cycle_offsets.size() * sizeof(int64));
+    header.cycle_literals = offset;
+    offset = align(offset + cycle_literals.size() * sizeof(int32));
+    header.file_size = offset;
+
+    FILE *out = fopen(filename.c_str(), "wb");
+    if (out == nullptr) {
+        LOG(ERROR) << "Cannot open file " << filename;
+        return false;
+    }
+
+    bool success =
+        writeAt(out, 0, &header, sizeof(header)) &&
+        writeAt(out, header.clause_offsets, clause_offsets.data(),
+                clause_offsets.size() * sizeof(int64)) &&
+        writeAt(out, header.clause_literals, clause_literals.data(),
+                clause_literals.size() * sizeof(int32)) &&
+        writeAt(out, header.occurences, occurences.data(),
+                occurences.size() * sizeof(int64)) &&
+        writeAt(out, header.permutation_offsets, permutation_offsets.data(),
+                permutation_offsets.size() * sizeof(int64)) &&
+        writeAt(out, header.cycle_offsets, cycle_offsets.data(),
+                cycle_offsets.size() * sizeof(int64)) &&
+        writeAt(out, header.cycle_literals, cycle_literals.data(),
+                cycle_literals.size() * sizeof(int32));
+
+    // Pad the last section so the file size matches the header
+    if (success && ftell(out) < header.file_size) {
+        const char zero = 0;
+        success = writeAt(out, header.file_size - 1, &zero, 1);
+    }
+
+    if (fclose(out) != 0)
+        success = false;
+    if (!success)
+        LOG(ERROR) << "Cannot write snapshot " << filename;
+    return success;
+}
+
+/*----------------------------------------------------------------------------*/
+
+Snapshot::Snapshot() :
+    _data(nullptr),
+    _size(0),
+    _header(nullptr),
+    _clause_offsets(nullptr),
+    _clause_literals(nullptr),
+    _occurences(nullptr),
+    _permutation_offsets(nullptr),
+    _cycle_offsets(nullptr),
+    _cycle_literals(nullptr) {
+}
+
+Snapshot::~Snapshot() {
+    close();
+}
+
+bool Snapshot::open(const std::string& filename) {
+    struct stat st;
+
+    close();
+
+    int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        LOG(ERROR) << "Cannot open file " << filename;
+        return false;
+    }
+    if (fstat(fd, &st) != 0 ||
+        st.st_size < static_cast<off_t>(sizeof(SnapshotHeader))) {
+        LOG(ERROR) << "Snapshot " << filename << " is truncated";
+        ::close(fd);
+        return false;
+    }
+
+    void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (data == MAP_FAILED) {
+        LOG(ERROR) << "Cannot map snapshot " << filename;
+        return false;
+    }
+
+    _data = data;
+    _size = st.st_size;
+    _header = reinterpret_cast<const SnapshotHeader*>(data);
+
+    if (!checkHeader()) {
+        LOG(ERROR) << "Snapshot " << filename << " is not well formed.";
+        close();
+        return false;
+    }
+
+    const char *base = static_cast<const char*>(data);
+    _clause_offsets =
+        reinterpret_cast<const int64*>(base + _header->clause_offsets);
+    _clause_literals =
+        reinterpret_cast<const Literal*>(base + _header->clause_literals);
+    _occurences = reinterpret_cast<const int64*>(base + _header->occurences);
+    _permutation_offsets =
+        reinterpret_cast<const int64*>(base + _header->permutation_offsets);
+    _cycle_offsets =
+        reinterpret_cast<const int64*>(base + _header->cycle_offsets);
+    _cycle_literals =
+        reinterpret_cast<const Literal*>(base + _header->cycle_literals);
+
+    if (!checkSections()) {
+        LOG(ERROR) << "Snapshot " << filename << " is not well formed.";
+        close();
+        return false;
+    }
+    return true;
+}
+
+void Snapshot::close() {
+    if (_data != nullptr)
+        munmap(_data, _size);
+
+    _data = nullptr;
+    _size = 0;
+    _header = nullptr;
+    _clause_offsets = nullptr;
+    _clause_literals = nullptr;
+    _occurences = nullptr;
+    _permutation_offsets = nullptr;
+    _cycle_offsets = nullptr;
+    _cycle_literals = nullptr;
+}
+
+bool Snapshot::checkHeader() const {
+    const SnapshotHeader& h = *_header;
+
+    if (memcmp(h.magic, kSnapshotMagic, sizeof(kSnapshotMagic)) != 0)
+        return false;
+    if (h.version != kSnapshotVersion) {
+        LOG(ERROR) << "Snapshot version " << h.version << " not supported";
+        return false;
+    }
+    if (h.header_size != sizeof(SnapshotHeader) || h.file_size != _size)
+        return false;
+
+    // No count can exceed the file size, section sizes do not overflow
+    const int64 counts[] = { h.num_variables, h.num_stored_clauses,
+                             h.num_clause_literals, h.num_permutations,
+                             h.num_cycles, h.num_cycle_literals };
+    for (const int64 count : counts)
+        if (count < 0 || count > _size)
+            return false;
+
+    // Each section must be aligned, fit before the next one and in the file
+    const int64 sections[][3] = {  // offset, number of elements, element size
+        { h.clause_offsets, h.num_stored_clauses + 1, 8 },
+        { h.clause_literals, h.num_clause_literals, 4 },
+        { h.occurences, 3 * h.num_variables, 8 },
+        { h.permutation_offsets, h.num_permutations + 1, 8 },
+        { h.cycle_offsets, h.num_cycles + 1, 8 },
+        { h.cycle_literals, h.num_cycle_literals, 4 },
+    };
+    int64 end = sizeof(SnapshotHeader);
+    for (const int64 (&section)[3] : sections) {
+        if (section[0] < end || (section[0] & 7) != 0 || section[0] > _size ||
+            section[1] > (_size - section[0]) / section[2])
+            return false;
+        end = section[0] + section[1] * section[2];
+    }
+    return true;
+}
+
+bool Snapshot::checkSections() const {
+    const SnapshotHeader& h = *_header;
+
+    return checkOffsets(_clause_offsets, h.num_stored_clauses,
+                        h.num_clause_literals) &&
+        checkOffsets(_permutation_offsets, h.num_permutations, h.num_cycles) &&
+        checkOffsets(_cycle_offsets, h.num_cycles, h.num_cycle_literals) &&
+        checkLiterals(_clause_literals, h.num_clause_literals,
+                      h.num_variables) &&
+        checkLiterals(_cycle_literals, h.num_cycle_literals, h.num_variables);
+}
+
+void Snapshot::loadModel(CNFModel *model) const {
+    CHECK_NOTNULL(model);
+    const int64 num_vars = numberOfVariables();
+    std::vector<Literal> literals;
+
+    model->_num_variables = num_vars - 1;
+    model->_num_clauses = _header->num_clauses;
+    model->_clauses.reserve(numberOfClauses());
+    // Stored clauses are already distinct, the tags are only needed if a
+    // clause is added later
+    model->_has_tags = false;
+
+    for (int64 i = 0; i < numberOfClauses(); i++) {
+        literals.assign(clauseBegin(i), clauseEnd(i));
+        model->compute_sizes(literals);
+        model->_clauses.emplace_back(Clause::create(literals));
+    }
+
+    model->_positive_occurences.assign(positiveOccurences(),
+                                       positiveOccurences() + num_vars);
+    model->_negative_occurences.assign(negativeOccurences(),
+                                       negativeOccurences() + num_vars);
+    model->_occurences.assign(occurences(), occurences() + num_vars);
+}
+
+void Snapshot::loadGroup(Group *group) const {
+    CHECK_NOTNULL(group);
+    const int64 num_vars = numberOfVariables();
+
+    for (int64 p = 0; p < numberOfPermutations(); p++) {
+        std::unique_ptr<Permutation> permutation(new Permutation(num_vars));
+        for (int64 c = 0; c < numberOfCycles(p); c++) {
+            for (const Literal *it = cycleBegin(p, c); it != cycleEnd(p, c);
+                 ++it)
+                permutation->addToCurrentCycle(*it);
+            permutation->closeCurrentCycle();
+        }
+        group->addPermutation(std::move(permutation));
+    }
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,138 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/StaticBreaker.h"
+
+#include <memory>
+
+#include "cosy/Printer.h"
+#include "cosy/StreamWriter.h"
+
+namespace cosy {
+
+StaticBreaker::StaticBreaker(const Group& group, const Order& order,
+                             unsigned int num_vars) :
+    _group(group),
+    _order(order),
+    _num_vars(num_vars),
+    _max_length(0),
+    _num_aux(0),
+    _in_chain(num_vars, false) {
+}
+
+void StaticBreaker::generate() {
+    _clauses.clear();
+    _num_aux = 0;
+
+    for (const std::unique_ptr<Permutation>& permutation :
+             _group.permutations())
+        addChain(*permutation);
+}
+
+Literal StaticBreaker::newAuxiliary() {
+    return Literal(BooleanVariable(_num_vars + _num_aux++), true);
+}
+
+void StaticBreaker::addChain(const Permutation& permutation) {
+    const bool negate = _order.valueMode() == TRUE_LESS_FALSE;
+    std::vector<BooleanVariable> chain;
+    Literal previous(kNoLiteralIndex);  // e_{i-1}, none for the first element
+
+    for (const Literal& ordered : _order) {
+        if (_max_length > 0 && chain.size() == _max_length)
+            break;
+
+        const Literal x = negate ? ordered.negated() : ordered;
+        if (permutation.isTrivialImage(x))
+            continue;
+        const Literal image = permutation.imageOf(x);
+
+        // Second element of a 2-cycle already compared
+        const BooleanVariable image_variable = image.variable();
+        if (_in_chain[image_variable.value()] &&
+            permutation.imageOf(image) == x)
+            continue;
+
+        _in_chain[x.variable().value()] = true;
+        chain.push_back(x.variable());
+
+        std::vector<Literal> clause;
+        if (previous.index() != kNoLiteralIndex)
+            clause.push_back(previous.negated());
+        clause.push_back(x.negated());
+        if (image != x.negated())
+            clause.push_back(image);
+        _clauses.push_back(clause);
+
+        // Equality with the image is impossible, the chain ends here
+        if (image == x.negated())
+            break;
+
+        const Literal current = newAuxiliary();
+        for (const Literal& literal : { x.negated(), image }) {
+            clause.clear();
+            if (previous.index() != kNoLiteralIndex)
+                clause.push_back(previous.negated());
+            clause.push_back(literal);
+            clause.push_back(current);
+            _clauses.push_back(clause);
+        }
+        previous = current;
+    }
+
+    for (const BooleanVariable& variable : chain)
+        _in_chain[variable.value()] = false;
+}
+
+bool StaticBreaker::write(const std::string& filename,
+                          const CNFModel& model) const {
+    StreamWriter out(filename);
+    if (!out.good()) {
+        LOG(ERROR) << "Cannot open file " << filename;
+        return false;
+    }
+
+    // Auxiliary variables are numbered after the variables of the order
+    CHECK_LE(model.numberOfVariables(), static_cast<int64>(_num_vars));
+
+    out.writeString("p cnf ");
+    out.writeInt(numberOfVariables());
+    out.writeChar(' ');
+    out.writeInt(model.clauses().size() + _clauses.size());
+    out.writeChar('\n');
+
+    for (const std::unique_ptr<Clause>& clause : model.clauses()) {
+        for (const Literal& literal : *clause) {
+            out.writeInt(literal.signedValue());
+            out.writeChar(' ');
+        }
+        out.writeString("0\n");
+    }
+    for (const std::vector<Literal>& clause : _clauses) {
+        for (const Literal& literal : clause) {
+            out.writeInt(literal.signedValue());
+            out.writeChar(' ');
+        }
+        out.writeString("0\n");
+    }
+
+    if (!out.close()) {
+        LOG(ERROR) << "Cannot write file " << filename;
+        return false;
+    }
+    return true;
+}
+
+void StaticBreaker::summarize() const {
+    Printer::printStat("Symmetry breaking clauses",
+                       static_cast<int64>(_clauses.size()));
+    Printer::printStat("Auxiliary variables", static_cast<int64>(_num_aux));
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
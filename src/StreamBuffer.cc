@@ -66,6 +66,10 @@ void StreamBuffer::skipLine() {
     ++(*this);
 }
 
+bool StreamBuffer::eof() {
+    read();
+    return _index >= _size;
+}
 
 int StreamBuffer::operator*() {
     return static_cast<int>(read());
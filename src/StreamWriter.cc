@@ -0,0 +1,105 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/StreamWriter.h"
+
+#include <cstring>
+
+namespace cosy {
+
+StreamWriter::StreamWriter(const std::string& filename) :
+    StreamWriter(filename.c_str()) {
+}
+
+StreamWriter::StreamWriter(const char *filename) :
+    _filename(filename),
+    _out(nullptr),
+    _failed(false),
+    _size(0) {
+    _out = fopen(filename, "wb");
+    if (_out == nullptr)
+        LOG(ERROR) << "Cannot open file " << filename;
+}
+
+StreamWriter::~StreamWriter() {
+    close();
+}
+
+void StreamWriter::writeString(const char *string) {
+    writeBytes(string, strlen(string));
+}
+
+void StreamWriter::writeInt(int64 value) {
+    char digits[24];
+    int n = 0;
+    uint64 magnitude = value < 0 ? -static_cast<uint64>(value) : value;
+
+    do {
+        digits[n++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude != 0);
+
+    if (_size + n + 1 > kWriterBufferSize)
+        flush();
+
+    if (value < 0)
+        _buffer[_size++] = '-';
+    while (n > 0)
+        _buffer[_size++] = digits[--n];
+}
+
+void StreamWriter::writeBytes(const void *data, int64 size) {
+    const char *bytes = static_cast<const char*>(data);
+
+    while (size > 0) {
+        if (_size == kWriterBufferSize)
+            flush();
+        const int64 chunk = std::min<int64>(size, kWriterBufferSize - _size);
+        memcpy(_buffer + _size, bytes, chunk);
+        _size += chunk;
+        bytes += chunk;
+        size -= chunk;
+    }
+}
+
+void StreamWriter::writeVarint(uint64 value) {
+    if (_size + 10 > kWriterBufferSize)
+        flush();
+
+    while (value >= 0x80) {
+        _buffer[_size++] = static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    _buffer[_size++] = static_cast<char>(value);
+}
+
+bool StreamWriter::flush() {
+    if (_out != nullptr && _size > 0) {
+        if (fwrite(_buffer, 1, _size, _out) != static_cast<size_t>(_size))
+            _failed = true;
+    }
+    _size = 0;
+    return good();
+}
+
+bool StreamWriter::close() {
+    if (_out == nullptr)
+        return false;
+
+    flush();
+    if (fclose(_out) != 0)
+        _failed = true;
+    _out = nullptr;
+
+    if (_failed)
+        LOG(ERROR) << "Cannot write file " << _filename;
+    return !_failed;
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,131 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/SymmetricLearning.h"
+
+#include <memory>
+#include <utility>
+
+#include "cosy/Printer.h"
+
+namespace cosy {
+
+SymmetricLearning::SymmetricLearning(const Group& group,
+                                     const Assignment& assignment) :
+    _assignment(assignment),
+    _max_images(0),
+    _next_generator(0),
+    _point_of(2 * assignment.numberOfVariables(), -1),
+    _in_clause(2 * assignment.numberOfVariables(), false) {
+    // Relabel moved literals into a compact domain
+    for (const std::unique_ptr<Permutation>& perm : group.permutations()) {
+        for (const Literal& literal : perm->support()) {
+            int& point = _point_of[literal.index().value()];
+            if (point < 0) {
+                point = _points.size();
+                _points.push_back(literal);
+            }
+        }
+    }
+
+    const unsigned int num_points = _points.size();
+    for (const std::unique_ptr<Permutation>& perm : group.permutations()) {
+        DensePermutation generator(num_points);
+        for (const Literal& literal : perm->support()) {
+            const Literal image = perm->imageOf(literal);
+            generator.setImage(_point_of[literal.index().value()],
+                               _point_of[image.index().value()]);
+        }
+        if (!generator.isIdentity())
+            _generators.push_back(std::move(generator));
+    }
+}
+
+void SymmetricLearning::learntClause(const std::vector<Literal>& clause,
+                                     ClauseInjector *injector) {
+    IF_STATS_ENABLED({
+            ScopedTimeDistributionUpdater time(&_stats.learnt_time);
+        });
+
+    const unsigned int num_generators = _generators.size();
+    if (num_generators == 0)
+        return;
+
+    const unsigned int num_images =
+        _max_images == 0 || _max_images > num_generators ?
+        num_generators : _max_images;
+
+    for (const Literal& literal : clause)
+        _in_clause[literal.index().value()] = true;
+
+    for (unsigned int n = 0; n < num_images; n++) {
+        const DensePermutation& generator = _generators[_next_generator];
+        bool same = true;
+
+        _next_generator = (_next_generator + 1) % num_generators;
+
+        _image.clear();
+        for (const Literal& literal : clause) {
+            const int point = _point_of[literal.index().value()];
+            const Literal image = point < 0 ? literal :
+                _points[generator[point]];
+            same = same && _in_clause[image.index().value()];
+            _image.push_back(image);
+        }
+
+        IF_STATS_ENABLED(_stats.images.increment());
+
+        // The generator stabilizes the clause
+        if (same)
+            continue;
+
+        if (isUseful(&_image)) {
+            IF_STATS_ENABLED({
+                    if (_assignment.literalIsFalse(_image[0]))
+                        _stats.conflicts.increment();
+                    else
+                        _stats.units.increment();
+                });
+            injector->addClause(ClauseInjector::SYMMETRIC_LEARNT,
+                                kNoBooleanVariable, std::move(_image));
+            _image = std::vector<Literal>();
+        }
+    }
+
+    for (const Literal& literal : clause)
+        _in_clause[literal.index().value()] = false;
+}
+
+bool SymmetricLearning::isUseful(std::vector<Literal> *image) const {
+    int unassigned = -1;
+
+    for (unsigned int i = 0; i < image->size(); i++) {
+        const Literal literal = (*image)[i];
+        if (_assignment.literalIsTrue(literal))
+            return false;
+        if (!_assignment.literalIsAssigned(literal)) {
+            if (unassigned >= 0)
+                return false;
+            unassigned = i;
+        }
+    }
+
+    if (unassigned > 0)
+        std::swap((*image)[0], (*image)[unassigned]);
+    return true;
+}
+
+void SymmetricLearning::summarize() const {
+    Printer::printStat("Symmetric learning generators",
+                       static_cast<int64>(_generators.size()));
+    Printer::printStat("Symmetric learning budget",
+                       static_cast<int64>(_max_images));
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,37 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/SymmetryData.h"
+#include "cosy/OrderFactory.h"
+
+namespace cosy {
+
+SymmetryData::SymmetryData(unsigned int num_vars) :
+    _num_vars(num_vars),
+    _order_mode(DYNAMIC),
+    _order(nullptr) {
+}
+
+void SymmetryData::defineOrder(OrderMode vars, ValueMode value) {
+    if (vars == DYNAMIC || order(vars, value))
+        return;
+
+    _order_mode = vars;
+    _order = std::shared_ptr<const Order>
+        (OrderFactory::create(vars, value, _cnf_model, _group));
+}
+
+std::shared_ptr<const Order> SymmetryData::order(OrderMode vars,
+                                                 ValueMode value) const {
+    if (!_order || _order_mode != vars || _order->valueMode() != value)
+        return nullptr;
+    return _order;
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,142 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/SymmetryPropagator.h"
+
+#include <memory>
+#include <utility>
+
+namespace cosy {
+
+SymmetryPropagator::SymmetryPropagator(const Group& group,
+                                       const Assignment& assignment) :
+    _group(group),
+    _assignment(assignment),
+    _num_unsatisfied(group.numberOfPermutations(), 0),
+    _is_decision(assignment.numberOfVariables(), false),
+    _watchers(assignment.numberOfVariables()),
+    _implication_of(assignment.numberOfVariables()),
+    _is_implied(assignment.numberOfVariables(), false) {
+    for (int64 p = 0; p < group.numberOfPermutations(); p++) {
+        for (const Literal& literal : group.permutations()[p]->support()) {
+            std::vector<int64>& watchers =
+                _watchers[literal.variable().value()];
+            if (watchers.empty() || watchers.back() != p)
+                watchers.push_back(p);
+        }
+    }
+}
+
+void SymmetryPropagator::updateNotify(const Literal& literal,
+                                      bool is_decision) {
+    IF_STATS_ENABLED({
+            ScopedTimeDistributionUpdater time(&_stats.notify_time);
+        });
+
+    const BooleanVariable variable = literal.variable();
+    _is_decision[variable.value()] = is_decision;
+
+    for (const int64& p : _watchers[variable.value()]) {
+        const Permutation& permutation = *_group.permutations()[p];
+
+        // A decision whose image was missing is now satisfied
+        const Literal preimage = permutation.inverseOf(literal);
+        if (_is_decision[preimage.variable().value()] &&
+            _assignment.literalIsTrue(preimage))
+            _num_unsatisfied[p]--;
+
+        if (is_decision &&
+            !_assignment.literalIsTrue(permutation.imageOf(literal)))
+            _num_unsatisfied[p]++;
+    }
+
+    if (is_decision)
+        return;
+
+    for (const int64& p : _watchers[variable.value()]) {
+        if (!isWeaklyActive(p))
+            continue;
+
+        const Literal image = _group.permutations()[p]->imageOf(literal);
+        const int64 image_variable = image.variable().value();
+        if (_assignment.literalIsTrue(image) || _is_implied[image_variable])
+            continue;
+
+        _is_implied[image_variable] = true;
+        _implication_of[image_variable].permutation = p;
+        _implication_of[image_variable].source = literal;
+        _pending.push_back(image);
+
+        IF_STATS_ENABLED({
+                _stats.implications.increment();
+                if (_assignment.literalIsFalse(image))
+                    _stats.conflicts.increment();
+            });
+    }
+}
+
+void SymmetryPropagator::updateCancel(const Literal& literal) {
+    const BooleanVariable variable = literal.variable();
+    const bool was_decision = _is_decision[variable.value()];
+
+    for (const int64& p : _watchers[variable.value()]) {
+        const Permutation& permutation = *_group.permutations()[p];
+
+        const Literal preimage = permutation.inverseOf(literal);
+        if (_is_decision[preimage.variable().value()] &&
+            _assignment.literalIsTrue(preimage))
+            _num_unsatisfied[p]++;
+
+        if (was_decision &&
+            !_assignment.literalIsTrue(permutation.imageOf(literal)))
+            _num_unsatisfied[p]--;
+    }
+
+    _is_decision[variable.value()] = false;
+    _is_implied[variable.value()] = false;
+
+    // Pending implications may depend on the cancelled literal
+    for (const Literal& pending : _pending)
+        _is_implied[pending.variable().value()] = false;
+    _pending.clear();
+}
+
+Literal SymmetryPropagator::nextImplication() {
+    CHECK(hasImplication());
+    const Literal implied = _pending.front();
+    _pending.pop_front();
+    return implied;
+}
+
+Literal SymmetryPropagator::source(const Literal& implied) const {
+    DCHECK(_is_implied[implied.variable().value()]);
+    return _implication_of[implied.variable().value()].source;
+}
+
+std::vector<Literal>
+SymmetryPropagator::reason(const Literal& implied,
+                           const std::vector<Literal>& source_reason) const {
+    DCHECK(_is_implied[implied.variable().value()]);
+    const Implication& implication =
+        _implication_of[implied.variable().value()];
+    const Permutation& permutation =
+        *_group.permutations()[implication.permutation];
+    std::vector<Literal> literals;
+
+    literals.push_back(implied);
+    for (const Literal& literal : source_reason) {
+        const Literal image = permutation.isTrivialImage(literal) ?
+            literal : permutation.imageOf(literal);
+        if (image != implied)
+            literals.push_back(image);
+    }
+    return literals;
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,186 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/SymmetryReader.h"
+#include "cosy/BinaryReader.h"
+#include "cosy/BlissReader.h"
+#include "cosy/BreakIDReader.h"
+#include "cosy/DreadnautReader.h"
+#include "cosy/SaucyReader.h"
+
+namespace cosy {
+
+namespace {
+
+inline bool isBlank(int c) {
+    return c == ' ' || c == '\t';
+}
+
+inline bool startsInteger(int c) {
+    return (c >= '0' && c <= '9') || c == '-' || c == '+';
+}
+
+}  // namespace
+
+// static
+SymmetryReader* SymmetryReader::create(SymmetryReader::Format format) {
+    switch (format) {
+    case SAUCY:     return new SaucyReader();
+    case BREAKID:   return new BreakIDReader();
+    case BLISS:     return new BlissReader();
+    case DREADNAUT: return new DreadnautReader();
+    case BINARY:    return new BinaryReader();
+    default: return nullptr;
+    }
+}
+
+bool SymmetryReader::load(const std::string& symmetry_filename,
+                          unsigned int num_vars, Group *group) {
+    std::unique_ptr<Permutation> generator;
+    StreamBuffer in(symmetry_filename);
+    bool valid = true;
+    bool line_start = true;
+
+    _num_dropped = 0;
+    _seen.assign(2 * num_vars, false);
+
+    while (*in != '\0') {
+        const int c = *in;
+
+        if (line_start && (c == 'c' || c == '#')) {
+            in.skipLine();
+            continue;
+        }
+
+        if (c == '\n') {
+            ++in;
+            line_start = true;
+            if (generator != nullptr &&
+                !(hasContinuationLines() && isBlank(*in))) {
+                addGenerator(std::move(generator), valid, group);
+                valid = true;
+            }
+            continue;
+        }
+
+        line_start = false;
+        if (c == '(') {
+            if (generator == nullptr)
+                generator.reset(new Permutation(num_vars));
+            if (!readCycle(&in, num_vars, generator.get()))
+                valid = false;
+        } else {
+            ++in;  // Decoration outside cycles
+        }
+    }
+
+    if (generator != nullptr)
+        addGenerator(std::move(generator), valid, group);
+
+    if (_num_dropped > 0)
+        LOG(WARNING) << _num_dropped << " malformed generators dropped from "
+                     << symmetry_filename;
+    return true;
+}
+
+bool SymmetryReader::readCycle(StreamBuffer *in, unsigned int num_vars,
+                               Permutation *generator) {
+    StreamBuffer& stream = *in;
+    bool valid = true;
+    int signed_value;
+
+    _cycle.clear();
+    ++stream;  // '('
+
+    while (*stream != ')') {
+        const int c = *stream;
+        if (c == '\0') {
+            valid = false;
+            break;
+        }
+        if (!startsInteger(c)) {
+            ++stream;
+            continue;
+        }
+
+        const int value = stream.readInt();
+        if (!toSignedLiteral(value, num_vars, &signed_value)) {
+            valid = false;
+            continue;
+        }
+        if (signed_value == 0)
+            continue;
+
+        const Literal element(signed_value);
+        if (_seen[element.index().value()]) {
+            valid = false;
+            continue;
+        }
+        _seen[element.index().value()] = true;
+        _cycle.push_back(element);
+    }
+    if (*stream == ')')
+        ++stream;
+
+    // Fixed points and rejected cycles never reach the generator
+    if (!valid || _cycle.size() < 2) {
+        for (const Literal& element : _cycle)
+            _seen[element.index().value()] = false;
+        return valid;
+    }
+
+    for (const Literal& element : _cycle)
+        generator->addToCurrentCycle(element);
+    generator->closeCurrentCycle();
+
+    return true;
+}
+
+void SymmetryReader::completeNegatedCycles(Permutation *generator) {
+    const unsigned int num_cycles = generator->numberOfCycles();
+
+    for (unsigned int c = 0; c < num_cycles; ++c) {
+        const Permutation::Iterator cycle = generator->cycle(c);
+        if (!generator->isTrivialImage((*cycle.begin()).negated()))
+            continue;
+
+        _cycle.assign(cycle.begin(), cycle.end());
+
+        bool free = true;
+        for (const Literal& element : _cycle)
+            free = free && !_seen[element.negatedIndex().value()];
+        if (!free)
+            continue;
+
+        for (const Literal& element : _cycle) {
+            _seen[element.negatedIndex().value()] = true;
+            generator->addToCurrentCycle(element.negated());
+        }
+        generator->closeCurrentCycle();
+    }
+}
+
+void SymmetryReader::addGenerator(std::unique_ptr<Permutation> generator,
+                                  bool valid, Group *group) {
+    if (valid)
+        completeNegatedCycles(generator.get());
+
+    for (const Literal& element : generator->support())
+        _seen[element.index().value()] = false;
+
+    if (!valid) {
+        _num_dropped++;
+        return;
+    }
+
+    if (!generator->isIdentity())
+        group->addPermutation(std::move(generator));
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
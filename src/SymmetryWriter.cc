@@ -0,0 +1,45 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include "cosy/SymmetryWriter.h"
+#include "cosy/BinaryWriter.h"
+#include "cosy/BreakIDWriter.h"
+#include "cosy/SaucyWriter.h"
+
+namespace cosy {
+
+// static
+SymmetryWriter* SymmetryWriter::create(SymmetryWriter::Format format) {
+    switch (format) {
+    case SAUCY:   return new SaucyWriter();
+    case BREAKID: return new BreakIDWriter();
+    case BINARY:  return new BinaryWriter();
+    default: return nullptr;
+    }
+}
+
+bool SymmetryWriter::write(const std::string& symmetry_filename,
+                           unsigned int num_vars, const Group& group) {
+    StreamWriter out(symmetry_filename);
+
+    if (!out.good())
+        return false;
+
+    const int64 num_generators = group.numberOfPermutations();
+
+    writeHeader(num_vars, group, &out);
+    for (int64 i = 0; i < num_generators; i++)
+        writeGenerator(num_vars, *group.permutations()[i],
+                       i + 1 == num_generators, &out);
+    writeFooter(&out);
+
+    return out.close();
+}
+
+}  // namespace cosy
+
+/*
+ * Local Variables:
+ * mode: c++
+ * indent-tabs-mode: nil
+ * End:
+ */
@@ -0,0 +1,84 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+#include "cosy/ClauseCache.h"
+#include "cosy/ClauseInjector.h"
+
+namespace cosy {
+
+TEST(ClauseCache, literalOrderDoesNotMatter) {
+    ClauseCache cache(4);
+
+    cache.insert({ Literal(1), Literal(-2), Literal(3) });
+    ASSERT_TRUE(cache.contains({ Literal(3), Literal(1), Literal(-2) }));
+    ASSERT_FALSE(cache.contains({ Literal(1), Literal(2), Literal(3) }));
+    ASSERT_EQ(cache.numberOfHits(), 1);
+    ASSERT_EQ(cache.numberOfMisses(), 1);
+}
+
+TEST(ClauseCache, leastRecentlyUsedIsEvicted) {
+    ClauseCache cache(2);
+    const std::vector<Literal> a = { Literal(1), Literal(2) };
+    const std::vector<Literal> b = { Literal(1), Literal(3) };
+    const std::vector<Literal> c = { Literal(2), Literal(3) };
+
+    cache.insert(a);
+    cache.insert(b);
+    ASSERT_TRUE(cache.contains(a));
+    cache.insert(c);
+
+    ASSERT_EQ(cache.size(), 2);
+    ASSERT_TRUE(cache.contains(a));
+    ASSERT_TRUE(cache.contains(c));
+    ASSERT_FALSE(cache.contains(b));
+}
+
+TEST(ClauseCache, injectorSkipsClausesGiven) {
+    ClauseInjector injector;
+    const BooleanVariable cause(0);
+
+    injector.enableCache(8);
+    injector.addClause(ClauseInjector::ESBP, cause,
+                       { Literal(-1), Literal(-2) });
+    injector.getClause(ClauseInjector::ESBP, cause);
+
+    injector.addClause(ClauseInjector::ESBP, cause,
+                       { Literal(-2), Literal(-1) });
+    ASSERT_FALSE(injector.hasClause(ClauseInjector::ESBP, cause));
+
+    // Clauses removed on backtrack were never given to the solver
+    injector.addClause(ClauseInjector::ESBP, cause,
+                       { Literal(-1), Literal(-3) });
+    injector.removeClause(cause);
+    injector.addClause(ClauseInjector::ESBP, cause,
+                       { Literal(-1), Literal(-3) });
+    ASSERT_TRUE(injector.hasClause(ClauseInjector::ESBP, cause));
+    ASSERT_EQ(injector.cache()->numberOfHits(), 1);
+}
+
+TEST(ClauseCache, injectorGivesDeletedClausesAgain) {
+    ClauseInjector injector;
+    const BooleanVariable cause(0);
+
+    injector.enableCache(8);
+    injector.addClause(ClauseInjector::ESBP, cause,
+                       { Literal(-1), Literal(-2), Literal(-3) });
+    injector.getClause(ClauseInjector::ESBP, cause);
+
+    // The solver no longer has the clause once it deleted it
+    injector.deletedClause({ Literal(-3), Literal(-1), Literal(-2) });
+    ASSERT_EQ(injector.cache()->size(), 0);
+    injector.addClause(ClauseInjector::ESBP, cause,
+                       { Literal(-1), Literal(-2), Literal(-3) });
+    ASSERT_TRUE(injector.hasClause(ClauseInjector::ESBP, cause));
+
+    // Other learnt clauses are not in the cache
+    injector.getClause(ClauseInjector::ESBP, cause);
+    injector.deletedClause({ Literal(-1), Literal(-4), Literal(-5) });
+    ASSERT_EQ(injector.cache()->size(), 1);
+}
+
+}  // namespace cosy
@@ -0,0 +1,88 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <vector>
+
+#include "cosy/ClauseMinimizer.h"
+
+namespace cosy {
+
+class FakeReasons : public ReasonProvider<Literal> {
+ public:
+    bool reason(Literal literal, std::vector<Literal> *reason) override {
+        if (_reasons.find(literal) == _reasons.end())
+            return false;
+        *reason = _reasons[literal];
+        return true;
+    }
+
+    std::map<Literal, std::vector<Literal>> _reasons;
+};
+
+class ClauseMinimizerTest : public testing::Test {
+ protected:
+    static const unsigned int num_vars = 5;
+
+    ClauseMinimizerTest() : assignment(num_vars), levels(num_vars, 0),
+                            minimizer(assignment, levels) {}
+
+    virtual void SetUp() {
+        // x1@1, x2@2, x3@0, x4@2 (implied by x2), x5@3 (implied by x1)
+        const unsigned int level[] = { 1, 2, 0, 2, 3 };
+        for (int i = 1; i <= static_cast<int>(num_vars); i++) {
+            assignment.assignFromTrueLiteral(Literal(i));
+            levels[i - 1] = level[i - 1];
+        }
+        reasons._reasons[Literal(4)] = { Literal(-2) };
+        reasons._reasons[Literal(5)] = { Literal(-1), Literal(-4) };
+    }
+
+    std::vector<Literal> clause() {
+        return { Literal(-1), Literal(-2), Literal(-3), Literal(-4),
+                 Literal(-5) };
+    }
+
+    Assignment assignment;
+    std::vector<unsigned int> levels;
+    ClauseMinimizer minimizer;
+    FakeReasons reasons;
+};
+
+TEST_F(ClauseMinimizerTest, noMinimization) {
+    std::vector<Literal> literals = clause();
+
+    ASSERT_EQ(minimizer.minimize(&literals), 4);
+    ASSERT_EQ(literals.size(), 5);
+}
+
+TEST_F(ClauseMinimizerTest, levelZero) {
+    std::vector<Literal> literals = clause();
+
+    minimizer.setMode(LEVEL_ZERO_MINIMIZATION);
+    ASSERT_EQ(minimizer.minimize(&literals), 3);
+    ASSERT_EQ(literals, std::vector<Literal>({ Literal(-1), Literal(-2),
+                    Literal(-4), Literal(-5) }));
+}
+
+TEST_F(ClauseMinimizerTest, reasons) {
+    std::vector<Literal> literals = clause();
+
+    minimizer.setMode(REASON_MINIMIZATION);
+    minimizer.setReasonProvider(&reasons);
+    ASSERT_EQ(minimizer.minimize(&literals), 2);
+    ASSERT_EQ(literals, std::vector<Literal>({ Literal(-1), Literal(-2) }));
+}
+
+TEST_F(ClauseMinimizerTest, watchedLiteralsAreKept) {
+    std::vector<Literal> literals = { Literal(-3), Literal(-4), Literal(-1) };
+
+    minimizer.setMode(REASON_MINIMIZATION);
+    minimizer.setReasonProvider(&reasons);
+    minimizer.minimize(&literals);
+    ASSERT_EQ(literals, std::vector<Literal>({ Literal(-3), Literal(-4),
+                    Literal(-1) }));
+}
+
+}  // namespace cosy
@@ -0,0 +1,260 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "cosy/CosyManager.h"
+
+namespace cosy {
+
+class CosyManagerTest : public testing::Test {
+ protected:
+    static const unsigned int num_vars = 3;
+
+    virtual void SetUp() {
+        // Symmetric group on x1, x2, x3 generated by (1 2) and (2 3)
+        addTransposition(1, 2);
+        addTransposition(2, 3);
+        assignment.resize(num_vars);
+    }
+
+    void addTransposition(int a, int b) {
+        std::unique_ptr<Permutation> permutation(new Permutation(num_vars));
+        for (const int sign : { 1, -1 }) {
+            permutation->addToCurrentCycle(Literal(sign * a));
+            permutation->addToCurrentCycle(Literal(sign * b));
+            permutation->closeCurrentCycle();
+        }
+        group.addPermutation(std::move(permutation));
+    }
+
+    void assign(const Literal& literal, CosyManager *manager) {
+        assignment.assignFromTrueLiteral(literal);
+        manager->updateNotify(literal, &injector);
+    }
+
+    std::unique_ptr<Order> order() {
+        return std::unique_ptr<Order>(new IncreaseOrder(num_vars,
+                                                        TRUE_LESS_FALSE));
+    }
+
+    Group group;
+    Assignment assignment;
+    ClauseInjector injector;
+};
+
+TEST_F(CosyManagerTest, generatorsOnly) {
+    CosyManager manager(group, assignment);
+
+    manager.defineOrder(order());
+    ASSERT_EQ(manager.numberOfStatuses(), 2);
+    ASSERT_EQ(manager.numberOfStabilizerStatuses(), 0);
+}
+
+TEST_F(CosyManagerTest, stabilizerStatusesAreCapped) {
+    CosyManager unlimited(group, assignment);
+    CosyManager capped(group, assignment);
+
+    // x1 -> x2, x1 -> x3 at the first level and x2 -> x3 at the second one
+    unlimited.defineOrder(order(), 100);
+    ASSERT_EQ(unlimited.numberOfStabilizerStatuses(), 3);
+
+    capped.defineOrder(order(), 2);
+    ASSERT_EQ(capped.numberOfStabilizerStatuses(), 2);
+}
+
+TEST_F(CosyManagerTest, stabilizerStatusPrunes) {
+    CosyManager manager(group, assignment);
+
+    manager.defineOrder(order(), 100);
+
+    // x1 < x3 is only detected by an element mapping x3 to x1
+    assign(Literal(-1), &manager);
+    assign(Literal(3), &manager);
+
+    int64 generator_esbp = 0, stabilizer_esbp = 0;
+    for (int64 i = 0; i < manager.numberOfStatuses(); i++) {
+        if (i < group.numberOfPermutations())
+            generator_esbp += manager.status(i).numberOfESBP();
+        else
+            stabilizer_esbp += manager.status(i).numberOfESBP();
+    }
+    ASSERT_EQ(generator_esbp, 0);
+    ASSERT_EQ(stabilizer_esbp, 1);
+    ASSERT_TRUE(injector.hasClause(ClauseInjector::ESBP, BooleanVariable(2)));
+}
+
+TEST_F(CosyManagerTest, dynamicOrderFollowsDecisions) {
+    CosyManager manager(group, assignment);
+
+    manager.defineOrder(std::unique_ptr<Order>
+                        (new DynamicOrder(num_vars, TRUE_LESS_FALSE)));
+
+    // Only decisions are ordered, x3 becomes the first variable
+    assignment.assignFromTrueLiteral(Literal(-3));
+    manager.updateNotify(Literal(-3), true, &injector);
+    ASSERT_FALSE(injector.hasClause(ClauseInjector::ESBP,
+                                    BooleanVariable(1)));
+
+    // (2 3) maps x2 = true on x3 = false, which is smaller
+    assignment.assignFromTrueLiteral(Literal(2));
+    manager.updateNotify(Literal(2), false, &injector);
+    ASSERT_TRUE(injector.hasClause(ClauseInjector::ESBP, BooleanVariable(1)));
+    ASSERT_EQ(manager.status(1).numberOfESBP(), 1);
+}
+
+TEST_F(CosyManagerTest, adaptiveSleep) {
+    CosyManager manager(group, assignment);
+
+    manager.defineOrder(order());
+    manager.enableAdaptiveSleep(2, 2);
+
+    // x1 = x2 = true never makes (1 2) a reducer
+    assign(Literal(1), &manager);
+    assign(Literal(2), &manager);
+    ASSERT_TRUE(manager.isSleeping(0));
+    ASSERT_EQ(manager.numberOfSleepingStatuses(), 1);
+    ASSERT_EQ(manager.status(0).numberOfUpdates(), 2);
+
+    // A sleeping status is not notified
+    assign(Literal(3), &manager);
+    ASSERT_EQ(manager.status(0).numberOfUpdates(), 2);
+
+    for (const int value : { 3, 2, 1 }) {
+        assignment.unassignLiteral(Literal(value));
+        manager.updateCancel(Literal(value));
+    }
+    manager.restart();
+    ASSERT_FALSE(manager.isSleeping(0));
+    ASSERT_EQ(manager.numberOfSleepingStatuses(), 0);
+
+    // Second sleep lasts two restarts
+    assign(Literal(1), &manager);
+    assign(Literal(2), &manager);
+    ASSERT_TRUE(manager.isSleeping(0));
+    manager.restart();
+    ASSERT_TRUE(manager.isSleeping(0));
+    manager.restart();
+    ASSERT_FALSE(manager.isSleeping(0));
+}
+
+TEST_F(CosyManagerTest, severalESBPPerLiteral) {
+    addTransposition(1, 3);
+    CosyManager manager(group, assignment);
+
+    manager.defineOrder(order());
+    manager.setMaxESBPPerLiteral(2);
+    injector.setMaxClausesPerCause(ClauseInjector::ESBP, 2);
+
+    // x1 = false is worse than x2 = x3 = true for (1 2) and (1 3)
+    assign(Literal(2), &manager);
+    assign(Literal(3), &manager);
+    assign(Literal(-1), &manager);
+
+    ASSERT_EQ(manager.status(0).numberOfESBP(), 1);
+    ASSERT_EQ(manager.status(2).numberOfESBP(), 1);
+    for (int i = 0; i < 2; i++) {
+        ASSERT_TRUE(injector.hasClause(ClauseInjector::ESBP,
+                                       BooleanVariable(0)));
+        injector.getClause(ClauseInjector::ESBP, BooleanVariable(0));
+    }
+    ASSERT_FALSE(injector.hasClause(ClauseInjector::ESBP, BooleanVariable(0)));
+}
+
+TEST_F(CosyManagerTest, esbpPolicy) {
+    CosyManager disabled(group, assignment);
+
+    disabled.defineOrder(order());
+    disabled.setESBPPolicy(false, false);
+    assign(Literal(2), &disabled);
+    assign(Literal(-1), &disabled);
+    ASSERT_EQ(disabled.status(0).numberOfESBP(), 0);
+    ASSERT_FALSE(injector.hasClause(ClauseInjector::ESBP, BooleanVariable(0)));
+}
+
+TEST_F(CosyManagerTest, esbpTooLongIsSkipped) {
+    CosyManager manager(group, assignment);
+
+    // The ESBP of (1 2) on x1 = false, x2 = true has two literals
+    manager.defineOrder(order());
+    manager.setESBPPolicy(true, false, 1);
+    assign(Literal(2), &manager);
+    assign(Literal(-1), &manager);
+    ASSERT_EQ(manager.status(0).numberOfESBP(), 0);
+}
+
+TEST_F(CosyManagerTest, suggestLiteral) {
+    CosyManager manager(group, assignment);
+    Literal literal;
+
+    // (1 2) compares x1 with x2: x1 = true can not make it a reducer and
+    // neither can x2 = false
+    manager.defineOrder(order());
+    ASSERT_TRUE(manager.suggestLiteral(BooleanVariable(0), &literal));
+    ASSERT_EQ(literal, Literal(1));
+    ASSERT_TRUE(manager.suggestLiteral(BooleanVariable(1), &literal));
+    ASSERT_EQ(literal, Literal(-2));
+
+    // Once x1 = false, only x2 = false keeps x1 x2 lex-leader
+    assign(Literal(-1), &manager);
+    ASSERT_TRUE(manager.suggestLiteral(BooleanVariable(1), &literal));
+    ASSERT_EQ(literal, Literal(-2));
+
+    // x2 = false makes the pair equal, (1 2) is then done and (2 3)
+    // compares x2 with x3
+    assign(Literal(-2), &manager);
+    ASSERT_TRUE(manager.suggestLiteral(BooleanVariable(2), &literal));
+    ASSERT_EQ(literal, Literal(-3));
+    ASSERT_EQ(manager.status(0).numberOfESBP(), 0);
+    ASSERT_EQ(manager.status(1).numberOfESBP(), 0);
+}
+
+TEST_F(CosyManagerTest, restrictToAssumptions) {
+    CosyManager manager(group, assignment);
+
+    // Under the assumption x1, only (2 3) stays sound
+    manager.defineOrder(order());
+    ASSERT_TRUE(manager.canRestrictTo({ Literal(1) }));
+    manager.restrictTo({ Literal(1) });
+    ASSERT_FALSE(manager.isEnabled(0));
+    ASSERT_TRUE(manager.isEnabled(1));
+
+    // x1 = false, x2 = true is no more pruned by (1 2)
+    assign(Literal(-1), &manager);
+    assign(Literal(2), &manager);
+    ASSERT_EQ(manager.status(0).numberOfESBP(), 0);
+    for (const Literal& literal : { Literal(2), Literal(-1) }) {
+        assignment.unassignLiteral(literal);
+        manager.updateCancel(literal);
+    }
+
+    // Once (2 3) has pruned x2 = false, x3 = true, it can not be dropped
+    assign(Literal(-2), &manager);
+    assign(Literal(3), &manager);
+    ASSERT_EQ(manager.status(1).numberOfESBP(), 1);
+    ASSERT_TRUE(manager.canRestrictTo({ Literal(-1) }));
+    ASSERT_FALSE(manager.canRestrictTo({ Literal(2) }));
+}
+
+TEST_F(CosyManagerTest, levelZeroSimplification) {
+    CosyManager manager(group, assignment);
+
+    manager.defineOrder(order());
+    manager.enableLevelZeroSimplification();
+
+    // x2 = x3 = true at level 0: (2 3) can not prune any more
+    assign(Literal(2), &manager);
+    assign(Literal(3), &manager);
+    manager.restart();
+    ASSERT_EQ(manager.numberOfSettledStatuses(), 1);
+    ASSERT_FALSE(manager.isSettled(0));
+    ASSERT_TRUE(manager.isSettled(1));
+    ASSERT_EQ(manager.status(1).lookupSize(), 0);
+
+    // (1 2) still prunes x1 = false
+    assign(Literal(-1), &manager);
+    ASSERT_TRUE(injector.hasClause(ClauseInjector::ESBP, BooleanVariable(0)));
+}
+
+}  // namespace cosy
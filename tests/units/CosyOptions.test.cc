@@ -0,0 +1,72 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include "cosy/CosyOptions.h"
+
+namespace cosy {
+
+TEST(CosyOptions, defaults) {
+    CosyOptions options;
+
+    ASSERT_TRUE(options.esbp);
+    ASSERT_FALSE(options.esbp_forcing);
+    ASSERT_EQ(options.order, AUTO);
+    ASSERT_EQ(options.value, TRUE_LESS_FALSE);
+    ASSERT_EQ(options.finder, SymmetryFinder::BLISS);
+    ASSERT_EQ(options.max_esbp_per_literal, 1);
+    ASSERT_TRUE(options.parse(""));
+}
+
+TEST(CosyOptions, parse) {
+    CosyOptions options;
+
+    ASSERT_TRUE(options.parse("order=dynamic,esbp_forcing=1,"
+                              "max_esbp_size=32,finder=saucy,"
+                              "max_esbp_per_literal=4,"
+                              "esbp_selection=lowest_level,"
+                              "sleep_check_period=100,symmetric_learning,"
+                              "level_zero_simplification=1"));
+
+    ASSERT_EQ(options.order, DYNAMIC);
+    ASSERT_TRUE(options.esbp_forcing);
+    ASSERT_EQ(options.max_esbp_size, 32);
+    ASSERT_EQ(options.finder, SymmetryFinder::SAUCY);
+    ASSERT_EQ(options.max_esbp_per_literal, 4);
+    ASSERT_EQ(options.esbp_selection, LOWEST_LEVEL_ESBP);
+    ASSERT_EQ(options.sleep_check_period, 100);
+    ASSERT_TRUE(options.symmetric_learning);
+    ASSERT_TRUE(options.level_zero_simplification);
+}
+
+TEST(CosyOptions, rejectBadOptions) {
+    CosyOptions options;
+
+    ASSERT_FALSE(options.parse("unknown=1"));
+    ASSERT_FALSE(options.parse("order=random"));
+    ASSERT_FALSE(options.parse("max_esbp_size=-3"));
+    ASSERT_FALSE(options.parse("max_esbp_per_literal=0"));
+    ASSERT_FALSE(options.parse("esbp=maybe"));
+
+    // Nothing is applied from a spec with an error, even before it
+    ASSERT_FALSE(options.parse("order=dynamic,esbp_forcing=1,unknown=1"));
+    ASSERT_EQ(options.order, AUTO);
+    ASSERT_FALSE(options.esbp_forcing);
+    ASSERT_EQ(options.max_esbp_per_literal, 1);
+}
+
+TEST(CosyOptions, toStringRoundTrip) {
+    CosyOptions options, parsed;
+
+    ASSERT_TRUE(options.parse("order=occurence,value=false_less_true,"
+                              "row_interchangeability=1,"
+                              "symmetric_polarity=1"));
+    ASSERT_TRUE(parsed.parse(options.toString()));
+    ASSERT_EQ(parsed.toString(), options.toString());
+    ASSERT_EQ(parsed.order, OCCURENCE);
+    ASSERT_EQ(parsed.value, FALSE_LESS_TRUE);
+    ASSERT_TRUE(parsed.row_interchangeability);
+    ASSERT_TRUE(parsed.symmetric_polarity);
+}
+
+}  // namespace cosy
@@ -2,6 +2,8 @@
 
 #include <gtest/gtest.h>
 
+#include <vector>
+
 #include "cosy/CosyStatus.h"
 
 namespace cosy {
@@ -98,6 +100,102 @@ TEST_F(CosyStatusTest, DetectForcingMax) {
     ASSERT_EQ(status->state(), FORCE_LEX_LEADER);
 }
 
+// Lookup order on the support of the permutation, as built by CosyManager
+static void lookupSupport(CosyStatus *status) {
+    status->clearLookupOrder();
+    for (const int value : { 1, 2, 3, 4, 5 })
+        status->addLookupLiteral(value);
+}
+
+TEST_F(CosyStatusTest, CompactLevelZeroPairs) {
+    lookupSupport(status.get());
+
+    // x1 = x2 at level 0: the pairs of x1 and x2 stay equal
+    for (const int value : { 1, 2 }) {
+        assignment.assignFromTrueLiteral(value);
+        status->updateNotify(value);
+    }
+    status->compactLookupOrder();
+
+    ASSERT_EQ(status->lookupSize(), 3);
+    ASSERT_EQ(status->lookupIndex(), 0);
+    ASSERT_FALSE(status->isSettled());
+}
+
+TEST_F(CosyStatusTest, SettledAtLevelZero) {
+    lookupSupport(status.get());
+    for (const int value : { 1, -2 }) {
+        assignment.assignFromTrueLiteral(value);
+        status->updateNotify(value);
+    }
+    status->compactLookupOrder();
+
+    ASSERT_EQ(status->lookupSize(), 5);
+    ASSERT_TRUE(status->isSettled());
+}
+
+TEST(CosyStatusInvertingTest, CompactKeepsTwoLiteralESBP) {
+    const int num_vars = 3;
+
+    // (1 2) (-1 -2) (3 -3)
+    Permutation permutation(num_vars);
+    for (const std::vector<int>& cycle : { std::vector<int>{ 1, 2 },
+                                           std::vector<int>{ -1, -2 },
+                                           std::vector<int>{ 3, -3 } }) {
+        for (const int value : cycle)
+            permutation.addToCurrentCycle(value);
+        permutation.closeCurrentCycle();
+    }
+    IncreaseOrder order(num_vars, TRUE_LESS_FALSE);
+    Assignment assignment(num_vars);
+    CosyStatus status(permutation, order, assignment);
+    for (const Literal& literal : order)
+        status.addLookupLiteral(literal);
+
+    for (const int value : { 1, 2 }) {
+        assignment.assignFromTrueLiteral(value);
+        status.updateNotify(value);
+    }
+    status.compactLookupOrder();
+    ASSERT_EQ(status.lookupSize(), 2);
+
+    assignment.assignFromTrueLiteral(-3);
+    status.updateNotify(-3);
+    ASSERT_EQ(status.state(), REDUCER);
+
+    // The pair of x2 is kept in front of (3 -3): -x1 -x2 x3
+    ClauseInjector injector;
+    status.generateESBP(BooleanVariable(2), &injector);
+    ASSERT_EQ(injector.getClause(ClauseInjector::ESBP,
+                                 BooleanVariable(2)).size(), 3);
+}
 
+TEST(CosyStatusInvertingTest, UnitESBPOnDynamicOrder) {
+    const int num_vars = 3;
+
+    // (3 -3)
+    Permutation permutation(num_vars);
+    permutation.addToCurrentCycle(3);
+    permutation.addToCurrentCycle(-3);
+    permutation.closeCurrentCycle();
+
+    // x3 is decided first, no unit was given before the search
+    DynamicOrder order(num_vars, TRUE_LESS_FALSE);
+    Assignment assignment(num_vars);
+    CosyStatus status(permutation, order, assignment);
+    order.append(BooleanVariable(2));
+    status.addLookupLiteral(Literal(3));
+
+    assignment.assignFromTrueLiteral(-3);
+    status.updateNotify(-3);
+    ASSERT_EQ(status.state(), REDUCER);
+
+    ClauseInjector injector;
+    status.generateESBP(BooleanVariable(2), &injector);
+    const std::vector<Literal> esbp =
+        injector.getClause(ClauseInjector::ESBP, BooleanVariable(2));
+    ASSERT_EQ(esbp.size(), 1);
+    ASSERT_EQ(esbp[0], Literal(3));
+}
 
 }  // namespace cosy
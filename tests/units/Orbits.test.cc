@@ -0,0 +1,78 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "cosy/DisjointSets.h"
+#include "cosy/Orbits.h"
+
+namespace cosy {
+
+TEST(DisjointSetsTest, unionFind) {
+    DisjointSets sets;
+
+    for (unsigned int i = 0; i < 6; i++)
+        sets.Add(i);
+    ASSERT_EQ(sets.num_sets(), 6u);
+
+    sets.Union(0, 1);
+    sets.Union(2, 3);
+    sets.Union(1, 3);
+    ASSERT_EQ(sets.num_sets(), 3u);
+    ASSERT_EQ(sets.Find(0), sets.Find(2));
+    ASSERT_NE(sets.Find(0), sets.Find(4));
+    ASSERT_EQ(sets.setSize(3), 4);
+
+    sets.clear();
+    ASSERT_EQ(sets.num_elements(), 0u);
+    ASSERT_FALSE(sets.contains(0));
+}
+
+TEST(OrbitsTest, sortedByRepresentative) {
+    const unsigned int num_vars = 8;
+    std::unique_ptr<Permutation> p1(new Permutation(num_vars));
+    std::unique_ptr<Permutation> p2(new Permutation(num_vars));
+    Orbits orbits;
+
+    // (7 5)(-7 -5) and (3 8 2)(-3 -8 -2)(5 6)(-5 -6)
+    for (const int sign : { 1, -1 }) {
+        p1->addToCurrentCycle(Literal(sign * 7));
+        p1->addToCurrentCycle(Literal(sign * 5));
+        p1->closeCurrentCycle();
+
+        p2->addToCurrentCycle(Literal(sign * 3));
+        p2->addToCurrentCycle(Literal(sign * 8));
+        p2->addToCurrentCycle(Literal(sign * 2));
+        p2->closeCurrentCycle();
+        p2->addToCurrentCycle(Literal(sign * 5));
+        p2->addToCurrentCycle(Literal(sign * 6));
+        p2->closeCurrentCycle();
+    }
+
+    orbits.assign({ p1.get(), p2.get() });
+
+    const std::vector<int> offsets = { 0, 3, 6 };
+    const std::vector<BooleanVariable> members = {
+        BooleanVariable(1), BooleanVariable(2), BooleanVariable(7),
+        BooleanVariable(4), BooleanVariable(5), BooleanVariable(6) };
+
+    ASSERT_EQ(orbits.numberOfOrbits(), 2);
+    ASSERT_EQ(orbits.offsets(), offsets);
+    ASSERT_EQ(orbits.members(), members);
+    ASSERT_EQ(orbits.representative(1), BooleanVariable(4));
+
+    int64 num_orbits = 0;
+    for (const Orbits::Orbit orbit : orbits) {
+        ASSERT_EQ(orbit.size(), 3u);
+        num_orbits++;
+    }
+    ASSERT_EQ(num_orbits, 2);
+
+    orbits.assign({ p1.get() });
+    ASSERT_EQ(orbits.numberOfOrbits(), 1);
+    ASSERT_EQ(orbits.orbit(0).size(), 2u);
+}
+
+}  // namespace cosy
@@ -0,0 +1,150 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+#include "cosy/Orbits.h"
+#include "cosy/Order.h"
+
+namespace cosy {
+
+namespace {
+
+// BreakID order recomputed from scratch at each step
+std::vector<Literal> referenceBreakIDOrder(int64 num_vars,
+                                           const Group& group) {
+    std::vector<Literal> order;
+    std::vector<Permutation*> Q, filter;
+    std::unordered_map<BooleanVariable, int64> occurence_generators;
+    Orbits orbits;
+
+    for (const std::unique_ptr<Permutation>& perm : group.permutations())
+        Q.push_back(perm.get());
+
+    while (Q.size() > 0) {
+        occurence_generators.clear();
+        for (const Permutation* permutation : Q)
+            for (const Literal& literal : permutation->support())
+                if (literal.isPositive())
+                    occurence_generators[literal.variable()]++;
+        occurence_generators[kNoBooleanVariable] =
+            std::numeric_limits<int>::max();
+
+        orbits.assign(Q);
+
+        unsigned int largestOrbit = 0;
+        BooleanVariable next = kNoBooleanVariable;
+        for (const Orbits::Orbit orbit : orbits) {
+            if (orbit.size() < largestOrbit)
+                continue;
+            for (const BooleanVariable& variable : orbit) {
+                if (occurence_generators[variable] == 0)
+                    continue;
+                const int occ_v = occurence_generators[variable];
+                const int occ_n = occurence_generators[next];
+                if (next == kNoBooleanVariable ||
+                    occ_v < occ_n || (occ_v == occ_n && variable < next)) {
+                    next = variable;
+                    largestOrbit = orbit.size();
+                }
+            }
+        }
+        if (next == kNoBooleanVariable)
+            break;
+
+        order.push_back(Literal(next, true));
+
+        filter.clear();
+        for (Permutation* permutation : Q)
+            if (permutation->isTrivialImage(Literal(next, true)))
+                filter.push_back(permutation);
+        Q = filter;
+    }
+
+    for (BooleanVariable var(0); var < num_vars; ++var) {
+        const Literal literal(var, true);
+        if (std::find(order.begin(), order.end(), literal) == order.end())
+            order.push_back(literal);
+    }
+    return order;
+}
+
+// Signed permutation of a random subset of the variables
+std::unique_ptr<Permutation> randomPermutation(int num_vars,
+                                               std::mt19937 *rng) {
+    std::vector<int> variables(num_vars);
+    std::unordered_map<int, int> image;
+    std::unique_ptr<Permutation> permutation(new Permutation(num_vars));
+
+    for (int v = 0; v < num_vars; v++)
+        variables[v] = v + 1;
+    std::shuffle(variables.begin(), variables.end(), *rng);
+    variables.resize(2 + (*rng)() % (num_vars / 3));
+
+    std::vector<int> images(variables);
+    std::shuffle(images.begin(), images.end(), *rng);
+    for (unsigned int i = 0; i < variables.size(); i++) {
+        const int sign = (*rng)() % 4 == 0 ? -1 : 1;
+        image[variables[i]] = sign * images[i];
+        image[-variables[i]] = -sign * images[i];
+    }
+
+    std::unordered_map<int, bool> visited;
+    for (const auto& entry : image) {
+        int element = entry.first;
+        if (visited[element] || image[element] == element)
+            continue;
+        while (!visited[element]) {
+            visited[element] = true;
+            permutation->addToCurrentCycle(Literal(element));
+            element = image[element];
+        }
+        permutation->closeCurrentCycle();
+    }
+    return permutation;
+}
+
+}  // namespace
+
+TEST(BreakIDOrderTest, sameAsReference) {
+    std::mt19937 rng(2017);
+
+    for (int round = 0; round < 200; round++) {
+        const int num_vars = 10 + rng() % 40;
+        const int num_generators = 1 + rng() % 12;
+        Group group;
+
+        for (int g = 0; g < num_generators; g++)
+            group.addPermutation(randomPermutation(num_vars, &rng));
+
+        const BreakIDOrder order(num_vars, TRUE_LESS_FALSE, group);
+        const std::vector<Literal> expected =
+            referenceBreakIDOrder(num_vars, group);
+
+        ASSERT_EQ(std::vector<Literal>(order.begin(), order.end()), expected);
+    }
+}
+
+TEST(DynamicOrderTest, appendAndCompare) {
+    DynamicOrder order(4, TRUE_LESS_FALSE);
+
+    ASSERT_TRUE(order.append(BooleanVariable(2)));
+    ASSERT_TRUE(order.append(BooleanVariable(0)));
+    ASSERT_FALSE(order.append(BooleanVariable(2)));
+    ASSERT_EQ(order.size(), 2u);
+
+    ASSERT_EQ(order.leq(Literal(1), Literal(3)), Literal(3));
+    ASSERT_EQ(order.leq(Literal(-3), Literal(1)), Literal(-3));
+
+    // Unordered variables come last
+    ASSERT_EQ(order.leq(Literal(2), Literal(1)), Literal(1));
+    ASSERT_EQ(order.leq(Literal(1), Literal(2)), Literal(1));
+}
+
+}  // namespace cosy
@@ -0,0 +1,127 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "cosy/CosyManager.h"
+#include "cosy/RowInterchangeability.h"
+#include "cosy/RowOrdering.h"
+
+namespace cosy {
+
+class RowInterchangeabilityTest : public testing::Test {
+ protected:
+    static const unsigned int num_vars = 11;
+
+    // Variables of row r are 2r + 1 and 2r + 2, x9 x10 x11 are free
+    virtual void SetUp() {
+        addRowSwap(0, 1);
+        addRowSwap(1, 2);
+        addCycle({ 9, 10, 11 });
+        addRowSwap(0, 3);
+        addRowSwap(2, 3);
+        assignment.resize(num_vars);
+    }
+
+    void addRowSwap(int a, int b) {
+        std::unique_ptr<Permutation> permutation(new Permutation(num_vars));
+        for (const int sign : { 1, -1 }) {
+            for (int c = 1; c <= 2; c++) {
+                permutation->addToCurrentCycle(Literal(sign * (2 * a + c)));
+                permutation->addToCurrentCycle(Literal(sign * (2 * b + c)));
+                permutation->closeCurrentCycle();
+            }
+        }
+        group.addPermutation(std::move(permutation));
+    }
+
+    void addCycle(const std::vector<int>& cycle) {
+        std::unique_ptr<Permutation> permutation(new Permutation(num_vars));
+        for (const int sign : { 1, -1 }) {
+            for (const int value : cycle)
+                permutation->addToCurrentCycle(Literal(sign * value));
+            permutation->closeCurrentCycle();
+        }
+        group.addPermutation(std::move(permutation));
+    }
+
+    Group group;
+    Assignment assignment;
+};
+
+TEST_F(RowInterchangeabilityTest, detect) {
+    RowInterchangeability detector(num_vars);
+
+    detector.detect(group);
+    ASSERT_EQ(detector.matrices().size(), 1u);
+    ASSERT_EQ(detector.numberOfCovered(), 4);
+    ASSERT_FALSE(detector.isCovered(2));
+
+    const LiteralMatrix& matrix = *detector.matrices()[0];
+    ASSERT_EQ(matrix.numberOfRows(), 4u);
+    ASSERT_EQ(matrix.numberOfColumns(), 2u);
+
+    // Columns stay aligned across rows
+    std::vector<int> first_column;
+    for (unsigned int r = 0; r < matrix.numberOfRows(); r++) {
+        ASSERT_EQ(matrix.row(r)[0].variable().value() + 1,
+                  matrix.row(r)[1].variable().value());
+        first_column.push_back(matrix.row(r)[0].signedValue());
+    }
+    std::sort(first_column.begin(), first_column.end());
+    ASSERT_EQ(first_column, std::vector<int>({ 1, 3, 5, 7 }));
+}
+
+TEST_F(RowInterchangeabilityTest, partialOverlapStartsNewMatrix) {
+    RowInterchangeability detector(num_vars);
+
+    // Swaps a single column of two rows
+    std::unique_ptr<Permutation> permutation(new Permutation(num_vars));
+    for (const int sign : { 1, -1 }) {
+        permutation->addToCurrentCycle(Literal(sign * 1));
+        permutation->addToCurrentCycle(Literal(sign * 3));
+        permutation->closeCurrentCycle();
+    }
+    group.addPermutation(std::move(permutation));
+
+    // It does not fit the first matrix and starts its own one
+    detector.detect(group);
+    ASSERT_EQ(detector.matrices().size(), 2u);
+    ASSERT_EQ(detector.matrices()[0]->numberOfRows(), 4u);
+    ASSERT_EQ(detector.matrices()[1]->numberOfRows(), 2u);
+    ASSERT_EQ(detector.matrices()[1]->numberOfColumns(), 1u);
+}
+
+TEST_F(RowInterchangeabilityTest, rowOrderingFollowsOrder) {
+    RowInterchangeability detector(num_vars);
+    IncreaseOrder order(num_vars, TRUE_LESS_FALSE);
+
+    detector.detect(group);
+    RowOrdering ordering(*detector.matrices()[0], order, num_vars);
+
+    ASSERT_EQ(ordering.swaps().size(), 3u);
+    for (unsigned int i = 0; i < ordering.swaps().size(); i++) {
+        const Permutation& swap = *ordering.swaps()[i];
+        const Literal upper(static_cast<int>(2 * i + 1));
+        const Literal lower(static_cast<int>(2 * i + 3));
+
+        ASSERT_EQ(swap.imageOf(upper), lower);
+        ASSERT_EQ(swap.imageOf(upper.negated()), lower.negated());
+    }
+}
+
+TEST_F(RowInterchangeabilityTest, managerReplacesCoveredGenerators) {
+    CosyManager manager(group, assignment);
+
+    manager.defineOrder(std::unique_ptr<Order>
+                        (new IncreaseOrder(num_vars, TRUE_LESS_FALSE)),
+                        0, true);
+    ASSERT_EQ(manager.numberOfGeneratorStatuses(), 1);
+    ASSERT_EQ(manager.numberOfRowStatuses(), 3);
+    ASSERT_EQ(manager.numberOfStabilizerStatuses(), 0);
+}
+
+}  // namespace cosy
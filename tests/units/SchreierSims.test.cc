@@ -0,0 +1,119 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "cosy/SchreierSims.h"
+
+namespace cosy {
+
+namespace {
+
+// Add a generator given by its positive cycles, negated cycles are added.
+void addGenerator(const std::vector< std::vector<int> >& cycles,
+                  unsigned int num_vars, Group *group) {
+    std::unique_ptr<Permutation> permutation(new Permutation(num_vars));
+    for (const int sign : { 1, -1 }) {
+        for (const std::vector<int>& cycle : cycles) {
+            for (const int v : cycle)
+                permutation->addToCurrentCycle(Literal(sign * v));
+            permutation->closeCurrentCycle();
+        }
+    }
+    group->addPermutation(std::move(permutation));
+}
+
+}  // namespace
+
+TEST(SchreierSimsTest, symmetricGroup) {
+    const unsigned int num_vars = 5;
+    Group group;
+
+    addGenerator({ { 1, 2 } }, num_vars, &group);
+    addGenerator({ { 1, 2, 3, 4 } }, num_vars, &group);
+
+    SchreierSims schreier_sims(group, num_vars);
+    ASSERT_TRUE(schreier_sims.compute());
+    ASSERT_TRUE(schreier_sims.isComplete());
+    ASSERT_EQ(schreier_sims.order(), BigUnsigned(24));
+    ASSERT_EQ(schreier_sims.numberOfPoints(), 8);
+    ASSERT_EQ(schreier_sims.basicOrbitSize(0), 4);
+
+    for (unsigned int level = 0; level < schreier_sims.baseSize(); level++) {
+        const Literal base_point = schreier_sims.basePoint(level);
+        for (const Literal& literal : schreier_sims.basicOrbit(level)) {
+            std::unique_ptr<Permutation> u =
+                schreier_sims.cosetRepresentative(level, literal);
+            ASSERT_NE(u, nullptr);
+            if (literal != base_point) {
+                ASSERT_EQ(u->imageOf(base_point), literal);
+            }
+            for (unsigned int previous = 0; previous < level; previous++)
+                ASSERT_TRUE(u->isTrivialImage(
+                                schreier_sims.basePoint(previous)));
+        }
+    }
+    ASSERT_EQ(schreier_sims.cosetRepresentative(0, Literal(5)), nullptr);
+}
+
+TEST(SchreierSimsTest, baseHint) {
+    const unsigned int num_vars = 4;
+    Group group;
+
+    addGenerator({ { 1, 2, 3, 4 } }, num_vars, &group);
+
+    SchreierSims schreier_sims(group, num_vars);
+    ASSERT_TRUE(schreier_sims.compute({ Literal(3) },
+                                      SchreierSims::Budget()));
+    ASSERT_EQ(schreier_sims.basePoint(0), Literal(3));
+    ASSERT_EQ(schreier_sims.order(), BigUnsigned(4));
+}
+
+TEST(SchreierSimsTest, largeOrder) {
+    const unsigned int num_vars = 140;
+    Group group;
+
+    for (int v = 1; v < static_cast<int>(num_vars); v += 2)
+        addGenerator({ { v, v + 1 } }, num_vars, &group);
+
+    SchreierSims schreier_sims(group, num_vars);
+    ASSERT_TRUE(schreier_sims.compute());
+    ASSERT_EQ(schreier_sims.order().toString(), "1180591620717411303424");
+}
+
+TEST(SchreierSimsTest, largeFactor) {
+    // Orbit sizes are size_t, they must not be truncated to 32 bits
+    BigUnsigned order(3);
+    order *= static_cast<uint64>(1) << 32;
+    ASSERT_EQ(order.toString(), "12884901888");
+
+    order = BigUnsigned(1);
+    order *= 10000000000000000000ULL;
+    order *= 18446744073709551615ULL;
+    ASSERT_EQ(order.toString(), "184467440737095516150000000000000000000");
+
+    order *= 0;
+    ASSERT_TRUE(order.isZero());
+}
+
+TEST(SchreierSimsTest, budget) {
+    const unsigned int num_vars = 8;
+    Group group;
+    SchreierSims::Budget budget;
+
+    addGenerator({ { 1, 2 } }, num_vars, &group);
+    addGenerator({ { 1, 2, 3, 4, 5, 6, 7, 8 } }, num_vars, &group);
+
+    budget.max_sifts = 0;
+    SchreierSims schreier_sims(group, num_vars);
+    ASSERT_FALSE(schreier_sims.compute(std::vector<Literal>(), budget));
+    ASSERT_FALSE(schreier_sims.isComplete());
+    ASSERT_FALSE(schreier_sims.order().isZero());
+
+    ASSERT_TRUE(schreier_sims.compute());
+    ASSERT_EQ(schreier_sims.order(), BigUnsigned(40320));
+}
+
+}  // namespace cosy
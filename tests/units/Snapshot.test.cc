@@ -0,0 +1,179 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "cosy/CNFReader.h"
+#include "cosy/SaucyReader.h"
+#include "cosy/Snapshot.h"
+
+namespace cosy {
+
+class SnapshotTest : public testing::Test {
+ protected:
+    virtual void SetUp() {
+        CNFReader cnf_reader;
+        SaucyReader saucy_reader;
+
+        ASSERT_TRUE(cnf_reader.load("tests/resources/simple.cnf", &model));
+        ASSERT_TRUE(saucy_reader.load("tests/resources/simple.cnf.sym",
+                                      model.numberOfVariables(), &group));
+        filename = testing::TempDir() + "cosy_snapshot.bin";
+    }
+
+    virtual void TearDown() {
+        std::remove(filename.c_str());
+    }
+
+    SnapshotHeader readHeader() {
+        SnapshotHeader header;
+        std::ifstream file(filename, std::ios::binary);
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        return header;
+    }
+
+    // Overwrite the 8 bytes at the given offset of the file
+    void patch(int64 offset, int64 value) {
+        std::fstream file(filename,
+                          std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(offset);
+        file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    CNFModel model;
+    Group group;
+    std::string filename;
+};
+
+TEST_F(SnapshotTest, writeAndOpen) {
+    SnapshotWriter writer;
+    Snapshot snapshot;
+
+    ASSERT_TRUE(writer.write(filename, model, group));
+    ASSERT_TRUE(snapshot.open(filename));
+
+    ASSERT_EQ(snapshot.numberOfVariables(), model.numberOfVariables());
+    ASSERT_EQ(snapshot.numberOfClauses(),
+              static_cast<int64>(model.clauses().size()));
+    ASSERT_EQ(snapshot.numberOfPermutations(), group.numberOfPermutations());
+
+    const Clause& clause = *model.clauses()[0];
+    ASSERT_EQ(snapshot.clauseEnd(0) - snapshot.clauseBegin(0), clause.size());
+    for (int i = 0; i < clause.size(); i++)
+        ASSERT_EQ(snapshot.clauseBegin(0)[i], clause.begin()[i]);
+
+    for (int64 v = 0; v < model.numberOfVariables(); v++)
+        ASSERT_EQ(snapshot.occurences()[v], model.occurences()[v]);
+
+    const Permutation& permutation = *group.permutations()[0];
+    ASSERT_EQ(snapshot.numberOfCycles(0),
+              static_cast<int64>(permutation.numberOfCycles()));
+    const Literal* element = snapshot.cycleBegin(0, 0);
+    for (const Literal& literal : permutation.cycle(0))
+        ASSERT_EQ(*element++, literal);
+}
+
+TEST_F(SnapshotTest, loadModelAndGroup) {
+    SnapshotWriter writer;
+    Snapshot snapshot;
+    CNFModel loaded_model;
+    Group loaded_group;
+
+    ASSERT_TRUE(writer.write(filename, model, group));
+    ASSERT_TRUE(snapshot.open(filename));
+
+    snapshot.loadModel(&loaded_model);
+    snapshot.loadGroup(&loaded_group);
+
+    ASSERT_EQ(loaded_model.numberOfVariables(), model.numberOfVariables());
+    ASSERT_EQ(loaded_model.numberOfClauses(), model.numberOfClauses());
+    ASSERT_EQ(loaded_model.numberOfLargeClauses(),
+              model.numberOfLargeClauses());
+    ASSERT_EQ(loaded_group.numberOfPermutations(),
+              group.numberOfPermutations());
+    ASSERT_EQ(loaded_group.numberOfSymmetricVariables(),
+              group.numberOfSymmetricVariables());
+
+    for (unsigned int p = 0; p < group.permutations().size(); p++) {
+        const Permutation& expected = *group.permutations()[p];
+        const Permutation& actual = *loaded_group.permutations()[p];
+        ASSERT_EQ(expected.support(), actual.support());
+    }
+}
+
+TEST_F(SnapshotTest, loadedModelSkipsDuplicates) {
+    SnapshotWriter writer;
+    Snapshot snapshot;
+    CNFModel loaded_model;
+
+    ASSERT_TRUE(writer.write(filename, model, group));
+    ASSERT_TRUE(snapshot.open(filename));
+    snapshot.loadModel(&loaded_model);
+
+    const Clause& clause = *model.clauses()[0];
+    std::vector<Literal> literals(clause.begin(), clause.end());
+    std::reverse(literals.begin(), literals.end());
+    loaded_model.addClause(&literals);
+    ASSERT_EQ(loaded_model.clauses().size(), model.clauses().size());
+
+    literals = { Literal(1), Literal(2) };
+    loaded_model.addClause(&literals);
+    ASSERT_EQ(loaded_model.clauses().size(), model.clauses().size() + 1);
+}
+
+TEST_F(SnapshotTest, rejectBadFile) {
+    Snapshot snapshot;
+
+    ASSERT_FALSE(snapshot.open("tests/resources/simple.cnf"));
+    ASSERT_FALSE(snapshot.isOpen());
+}
+
+TEST_F(SnapshotTest, rejectTruncatedFile) {
+    SnapshotWriter writer;
+    Snapshot snapshot;
+
+    // The header is kept consistent with the new size, only the sections
+    // tell the file is truncated
+    ASSERT_TRUE(writer.write(filename, model, group));
+    const int64 size = readHeader().cycle_offsets;
+    ASSERT_EQ(truncate(filename.c_str(), size), 0);
+    patch(offsetof(SnapshotHeader, file_size), size);
+
+    ASSERT_FALSE(snapshot.open(filename));
+    ASSERT_FALSE(snapshot.isOpen());
+}
+
+TEST_F(SnapshotTest, rejectCorruptedSections) {
+    SnapshotWriter writer;
+    Snapshot snapshot;
+
+    // (n + 1) * 8 overflows to 8 bytes
+    ASSERT_TRUE(writer.write(filename, model, group));
+    patch(offsetof(SnapshotHeader, num_stored_clauses),
+          static_cast<int64>(1) << 61);
+    ASSERT_FALSE(snapshot.open(filename));
+
+    // The last clause would end past the clause literals
+    ASSERT_TRUE(writer.write(filename, model, group));
+    const SnapshotHeader header = readHeader();
+    patch(header.clause_offsets + 8 * header.num_stored_clauses,
+          header.num_clause_literals + 1000);
+    ASSERT_FALSE(snapshot.open(filename));
+
+    // Literals of a cycle must be literals of the model
+    ASSERT_TRUE(writer.write(filename, model, group));
+    patch(header.cycle_literals, 2 * header.num_variables);
+    ASSERT_FALSE(snapshot.open(filename));
+
+    ASSERT_TRUE(writer.write(filename, model, group));
+    ASSERT_TRUE(snapshot.open(filename));
+}
+
+}  // namespace cosy
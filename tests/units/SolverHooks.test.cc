@@ -0,0 +1,85 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "cosy/SolverHooks.h"
+
+namespace cosy {
+
+class SolverHooksTest : public testing::Test {
+ protected:
+    virtual void SetUp() {
+        // Exactly one of x1, x2, x3: the three variables are interchangeable
+        const std::vector<std::vector<Literal>> clauses = {
+            { Literal(1), Literal(2), Literal(3) },
+            { Literal(-1), Literal(-2) },
+            { Literal(-1), Literal(-3) },
+            { Literal(-2), Literal(-3) },
+        };
+
+        adapter = std::unique_ptr<LiteralAdapter<Literal>>
+            (new LiteralAdapter<Literal>());
+        controller = std::unique_ptr<SymmetryController<Literal>>
+            (new SymmetryController<Literal>(3, adapter));
+        for (const std::vector<Literal>& clause : clauses)
+            controller->addClause(clause.data(), clause.size());
+        controller->findSymmetries(SymmetryFinder::Automorphism::BLISS);
+
+        CosyOptions options;
+        options.order = INCREASE;
+        controller->enableCosy(options);
+    }
+
+    std::unique_ptr<LiteralAdapter<Literal>> adapter;
+    std::unique_ptr<SymmetryController<Literal>> controller;
+    std::vector<SolverHooks<Literal>::PendingClause> pending;
+};
+
+TEST_F(SolverHooksTest, disabledWithoutController) {
+    SolverHooks<Literal> hooks;
+
+    ASSERT_FALSE(hooks.enabled());
+    hooks.onEnqueue(Literal(-1), 1, true);
+    hooks.onRestart(0);
+    ASSERT_FALSE(hooks.pendingClauses(Literal(-1), &pending));
+    ASSERT_TRUE(pending.empty());
+}
+
+TEST_F(SolverHooksTest, esbpOfNotLexLeaderAssignment) {
+    SolverHooks<Literal> hooks;
+    hooks.setController(controller.get());
+
+    // x1 = false, x2 = true is greater than its image x1 = true, x2 = false
+    hooks.onEnqueue(Literal(-1), 1, true);
+    ASSERT_FALSE(hooks.pendingClauses(Literal(-1), &pending));
+    hooks.onEnqueue(Literal(2), 2, true);
+    ASSERT_TRUE(hooks.pendingClauses(Literal(2), &pending));
+
+    ASSERT_EQ(pending.size(), 1);
+    ASSERT_EQ(pending[0].type, ClauseInjector::ESBP);
+    for (const Literal& literal : pending[0].literals)
+        ASSERT_TRUE(literal == Literal(1) || literal == Literal(-2));
+
+    // Clauses are given once
+    ASSERT_FALSE(hooks.pendingClauses(Literal(2), &pending));
+    ASSERT_TRUE(pending.empty());
+}
+
+TEST_F(SolverHooksTest, backtrackDropsClauses) {
+    SolverHooks<Literal> hooks;
+    hooks.setController(controller.get());
+
+    hooks.onEnqueue(Literal(-1), 1, true);
+    hooks.onEnqueue(Literal(2), 2, true);
+    hooks.onBacktrack(Literal(2));
+    ASSERT_FALSE(hooks.pendingClauses(Literal(2), &pending));
+
+    // The assignment is consistent again after the backtrack
+    hooks.onEnqueue(Literal(-2), 2, true);
+    ASSERT_FALSE(hooks.pendingClauses(Literal(-2), &pending));
+}
+
+}  // namespace cosy
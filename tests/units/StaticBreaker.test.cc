@@ -0,0 +1,169 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cosy/CNFReader.h"
+#include "cosy/StaticBreaker.h"
+
+namespace cosy {
+
+class StaticBreakerTest : public testing::Test {
+ protected:
+    static const unsigned int num_vars = 4;
+
+    virtual void SetUp() {
+        // (1 2)(3 4) and (2 3) are not inverting, (1 -1) is
+        addPermutation({ { 1, 2 }, { 3, 4 } });
+        addPermutation({ { 2, 3 } });
+        addPermutation({ { 1, -1 } });
+    }
+
+    void addPermutation(const std::vector< std::vector<int> >& cycles) {
+        std::unique_ptr<Permutation> permutation(new Permutation(num_vars));
+        for (const std::vector<int>& cycle : cycles) {
+            for (const int value : cycle)
+                permutation->addToCurrentCycle(Literal(value));
+            permutation->closeCurrentCycle();
+            if (cycle[0] == -cycle[1])
+                continue;
+            for (const int value : cycle)
+                permutation->addToCurrentCycle(Literal(-value));
+            permutation->closeCurrentCycle();
+        }
+        group.addPermutation(std::move(permutation));
+    }
+
+    static bool isTrue(const Literal& literal, unsigned int values) {
+        return ((values >> literal.variable().value()) & 1) ==
+            (literal.isPositive() ? 1u : 0u);
+    }
+
+    static bool satisfies(const std::vector< std::vector<Literal> >& clauses,
+                          unsigned int values) {
+        for (const std::vector<Literal>& clause : clauses) {
+            bool satisfied = false;
+            for (const Literal& literal : clause)
+                satisfied = satisfied || isTrue(literal, values);
+            if (!satisfied)
+                return false;
+        }
+        return true;
+    }
+
+    // x <= g(x) with the given value order on x1 < x2 < x3 < x4
+    static bool isLexLeader(const Permutation& permutation,
+                            unsigned int values, bool true_less_false) {
+        for (unsigned int v = 0; v < num_vars; v++) {
+            const Literal x(BooleanVariable(v), true);
+            if (permutation.isTrivialImage(x))
+                continue;
+            const bool a = isTrue(x, values);
+            const bool b = isTrue(permutation.imageOf(x), values);
+            if (a != b)
+                return true_less_false ? a : b;
+        }
+        return true;
+    }
+
+    void checkEquivalence(ValueMode mode, unsigned int max_length) {
+        IncreaseOrder order(num_vars, mode);
+        StaticBreaker breaker(group, order, num_vars);
+
+        breaker.setMaxLength(max_length);
+        breaker.generate();
+
+        const unsigned int total = breaker.numberOfVariables();
+        ASSERT_LE(total, 16u);
+
+        // Project the models of the clauses on the original variables
+        for (unsigned int values = 0; values < (1u << num_vars); values++) {
+            bool extended = false;
+            for (unsigned int aux = 0; aux < (1u << (total - num_vars));
+                 aux++) {
+                if (satisfies(breaker.clauses(), values | aux << num_vars)) {
+                    extended = true;
+                    break;
+                }
+            }
+
+            bool leader = true;
+            for (const std::unique_ptr<Permutation>& permutation :
+                     group.permutations())
+                leader = leader &&
+                    isLexLeader(*permutation, values, mode == TRUE_LESS_FALSE);
+
+            if (max_length == 0) {
+                ASSERT_EQ(extended, leader);
+            } else if (leader) {
+                ASSERT_TRUE(extended);
+            }
+        }
+    }
+
+    Group group;
+};
+
+TEST_F(StaticBreakerTest, falseLessTrue) {
+    checkEquivalence(FALSE_LESS_TRUE, 0);
+}
+
+TEST_F(StaticBreakerTest, trueLessFalse) {
+    checkEquivalence(TRUE_LESS_FALSE, 0);
+}
+
+TEST_F(StaticBreakerTest, lengthLimitKeepsLexLeaders) {
+    IncreaseOrder order(num_vars, FALSE_LESS_TRUE);
+    StaticBreaker unlimited(group, order, num_vars);
+    StaticBreaker limited(group, order, num_vars);
+
+    unlimited.generate();
+    limited.setMaxLength(1);
+    limited.generate();
+    ASSERT_LT(limited.clauses().size(), unlimited.clauses().size());
+
+    checkEquivalence(FALSE_LESS_TRUE, 1);
+}
+
+TEST_F(StaticBreakerTest, noDuplicateLiterals) {
+    for (const ValueMode mode : { FALSE_LESS_TRUE, TRUE_LESS_FALSE }) {
+        IncreaseOrder order(num_vars, mode);
+        StaticBreaker breaker(group, order, num_vars);
+
+        // The clause of the inverting (1 -1) is a unit
+        breaker.generate();
+        for (std::vector<Literal> clause : breaker.clauses()) {
+            std::sort(clause.begin(), clause.end());
+            ASSERT_EQ(std::adjacent_find(clause.begin(), clause.end()),
+                      clause.end());
+        }
+    }
+}
+
+TEST_F(StaticBreakerTest, writeAugmentedCNF) {
+    const std::string filename = testing::TempDir() + "cosy_static.cnf";
+    IncreaseOrder order(num_vars, FALSE_LESS_TRUE);
+    StaticBreaker breaker(group, order, num_vars);
+    CNFModel model;
+    CNFModel augmented;
+    CNFReader reader;
+    std::vector<Literal> clause = { 1, 2, 3, 4 };
+
+    model.addClause(&clause);
+    breaker.generate();
+    ASSERT_TRUE(breaker.write(filename, model));
+    ASSERT_TRUE(reader.load(filename, &augmented));
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(augmented.numberOfClauses(),
+              static_cast<int64>(1 + breaker.clauses().size()));
+    ASSERT_EQ(augmented.numberOfVariables(),
+              static_cast<int64>(breaker.numberOfVariables()));
+}
+
+}  // namespace cosy
@@ -0,0 +1,94 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "cosy/SymmetricLearning.h"
+
+namespace cosy {
+
+class SymmetricLearningTest : public testing::Test {
+ protected:
+    static const unsigned int num_vars = 4;
+
+    virtual void SetUp() {
+        // Symmetric group on x1, x2, x3 generated by (1 2) and (2 3)
+        addTransposition(1, 2);
+        addTransposition(2, 3);
+        assignment.resize(num_vars);
+    }
+
+    void addTransposition(int a, int b) {
+        std::unique_ptr<Permutation> permutation(new Permutation(num_vars));
+        for (const int sign : { 1, -1 }) {
+            permutation->addToCurrentCycle(Literal(sign * a));
+            permutation->addToCurrentCycle(Literal(sign * b));
+            permutation->closeCurrentCycle();
+        }
+        group.addPermutation(std::move(permutation));
+    }
+
+    Group group;
+    Assignment assignment;
+    ClauseInjector injector;
+};
+
+TEST_F(SymmetricLearningTest, injectUnitImage) {
+    SymmetricLearning learning(group, assignment);
+
+    // (x1 v x2) is stable under (1 2), its image by (2 3) is (x1 v x3)
+    assignment.assignFromTrueLiteral(Literal(-3));
+    learning.learntClause({ 1, 2 }, &injector);
+
+    ASSERT_TRUE(injector.hasClause(ClauseInjector::SYMMETRIC_LEARNT,
+                                   kNoBooleanVariable));
+    const std::vector<Literal> image =
+        injector.getClause(ClauseInjector::SYMMETRIC_LEARNT,
+                           kNoBooleanVariable);
+    ASSERT_EQ(image, std::vector<Literal>({ 1, 3 }));
+    ASSERT_FALSE(injector.hasClause(ClauseInjector::SYMMETRIC_LEARNT,
+                                    kNoBooleanVariable));
+}
+
+TEST_F(SymmetricLearningTest, skipSatisfiedAndOpenImages) {
+    SymmetricLearning learning(group, assignment);
+
+    // (x1 v x3 v x4) is satisfied, (x1 v x2 v x4) has two free literals
+    assignment.assignFromTrueLiteral(Literal(3));
+    learning.learntClause({ 2, 3, 4 }, &injector);
+
+    ASSERT_FALSE(injector.hasClause(ClauseInjector::SYMMETRIC_LEARNT,
+                                    kNoBooleanVariable));
+}
+
+TEST_F(SymmetricLearningTest, conflictingImage) {
+    SymmetricLearning learning(group, assignment);
+
+    assignment.assignFromTrueLiteral(Literal(-2));
+    assignment.assignFromTrueLiteral(Literal(-4));
+    learning.learntClause({ 1, 4 }, &injector);
+
+    const std::vector<Literal> image =
+        injector.getClause(ClauseInjector::SYMMETRIC_LEARNT,
+                           kNoBooleanVariable);
+    ASSERT_EQ(image, std::vector<Literal>({ 2, 4 }));
+}
+
+TEST_F(SymmetricLearningTest, budgetRotatesGenerators) {
+    SymmetricLearning learning(group, assignment);
+
+    // Only (2 3) gives a unit image of (x1 v x2)
+    assignment.assignFromTrueLiteral(Literal(-3));
+    learning.setBudget(1);
+
+    learning.learntClause({ 1, 2 }, &injector);
+    ASSERT_FALSE(injector.hasClause(ClauseInjector::SYMMETRIC_LEARNT,
+                                    kNoBooleanVariable));
+    learning.learntClause({ 1, 2 }, &injector);
+    ASSERT_TRUE(injector.hasClause(ClauseInjector::SYMMETRIC_LEARNT,
+                                   kNoBooleanVariable));
+}
+
+}  // namespace cosy
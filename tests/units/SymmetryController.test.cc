@@ -34,4 +34,89 @@ TEST(SymmetryController, ConstructorSaucy)  {
     SymmetryController<Literal> symmetry(cnf_filename, tool, adapter);
 }
 
+TEST(SymmetryController, ConstructorInMemory)  {
+    std::unique_ptr<LiteralAdapter<Literal>> adapter
+        (new LiteralAdapter<Literal>());
+
+    // x1 and x2 are interchangeable, x3 is fixed
+    const Literal clauses[][2] = {
+        { Literal(1), Literal(2) },
+        { Literal(-1), Literal(-2) },
+        { Literal(1), Literal(3) },
+        { Literal(2), Literal(3) },
+    };
+
+    SymmetryController<Literal> symmetry(4, adapter);
+    for (const auto& clause : clauses)
+        symmetry.addClause(clause, 2);
+    symmetry.findSymmetries(SymmetryFinder::Automorphism::BLISS);
+
+    ASSERT_EQ(symmetry.group().numberOfPermutations(), 1);
+    const Permutation& permutation = *symmetry.group().permutations()[0];
+    ASSERT_EQ(permutation.imageOf(Literal(1)), Literal(2));
+    ASSERT_TRUE(permutation.isTrivialImage(Literal(3)));
+}
+
+// x1, x2, x3 not all equal is satisfiable and inverting the three
+// literals is a symmetry
+static void addNotAllEqual(SymmetryController<Literal> *symmetry) {
+    const Literal clauses[][3] = {
+        { Literal(1), Literal(2), Literal(3) },
+        { Literal(-1), Literal(-2), Literal(-3) },
+    };
+
+    for (const auto& clause : clauses)
+        symmetry->addClause(clause, 3);
+    symmetry->findSymmetries(SymmetryFinder::Automorphism::BLISS);
+}
+
+TEST(SymmetryController, SymmetricLearningWithoutLexLeaderUnits)  {
+    std::unique_ptr<LiteralAdapter<Literal>> adapter
+        (new LiteralAdapter<Literal>());
+    CosyOptions options;
+
+    // The lex-leader constraint of an inverting symmetry gives a unit
+    SymmetryController<Literal> breaking(3, adapter);
+    addNotAllEqual(&breaking);
+    breaking.enableCosy(options);
+    ASSERT_TRUE(breaking.hasClauseToInject(ClauseInjector::UNITS));
+
+    // A clause learnt from that unit, e.g. x1 itself, has an image that is
+    // not implied by the formula: -x1, and the solver would answer UNSAT
+    SymmetryController<Literal> learning(3, adapter);
+    addNotAllEqual(&learning);
+    ASSERT_TRUE(options.parse("esbp=0,symmetric_learning=1"));
+    learning.enableCosy(options);
+    ASSERT_FALSE(learning.hasClauseToInject(ClauseInjector::UNITS));
+    learning.beginSolve(std::vector<Literal>());
+    ASSERT_FALSE(learning.hasClauseToInject(ClauseInjector::UNITS));
+}
+
+TEST(SymmetryController, SymmetryPropagationWithoutLexLeaderClauses)  {
+    std::unique_ptr<LiteralAdapter<Literal>> adapter
+        (new LiteralAdapter<Literal>());
+    CosyOptions options;
+
+    // Every symmetry is weakly active without decisions, so the literals
+    // propagated at level 0 have implied images. A reason derived from the
+    // lex-leader unit has an image that is not implied by the formula.
+    SymmetryController<Literal> breaking(3, adapter);
+    addNotAllEqual(&breaking);
+    ASSERT_TRUE(options.parse("symmetry_propagation=1"));
+    breaking.enableCosy(options);
+    ASSERT_TRUE(breaking.hasClauseToInject(ClauseInjector::UNITS));
+    breaking.updateNotify(Literal(2), 0, false);
+    ASSERT_FALSE(breaking.hasSymmetricImplication());
+
+    SymmetryController<Literal> propagation(3, adapter);
+    addNotAllEqual(&propagation);
+    ASSERT_TRUE(options.parse("esbp=0,symmetry_propagation=1"));
+    propagation.enableCosy(options);
+    ASSERT_FALSE(propagation.hasClauseToInject(ClauseInjector::UNITS));
+    propagation.beginSolve(std::vector<Literal>());
+    ASSERT_FALSE(propagation.hasClauseToInject(ClauseInjector::UNITS));
+    propagation.updateNotify(Literal(2), 0, false);
+    ASSERT_TRUE(propagation.hasSymmetricImplication());
+}
+
 }  // namespace cosy
@@ -0,0 +1,127 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "cosy/SymmetryController.h"
+
+namespace cosy {
+
+class SymmetryDataTest : public testing::Test {
+ protected:
+    static const unsigned int num_pigeons = 4;
+    static const unsigned int num_holes = 3;
+    static const unsigned int num_vars = num_pigeons * num_holes;
+
+    virtual void SetUp() {
+        adapter = std::unique_ptr<LiteralAdapter<Literal>>
+            (new LiteralAdapter<Literal>());
+        builder = std::unique_ptr<SymmetryController<Literal>>
+            (new SymmetryController<Literal>(num_vars, adapter));
+
+        // Pigeon hole problem: pigeons and holes are interchangeable
+        for (unsigned int p = 0; p < num_pigeons; p++) {
+            std::vector<Literal> clause;
+            for (unsigned int h = 0; h < num_holes; h++)
+                clause.push_back(Literal(variable(p, h)));
+            builder->addClause(clause.data(), clause.size());
+        }
+        for (unsigned int h = 0; h < num_holes; h++) {
+            for (unsigned int a = 0; a < num_pigeons; a++) {
+                for (unsigned int b = a + 1; b < num_pigeons; b++) {
+                    const std::vector<Literal> clause = {
+                        Literal(-variable(a, h)), Literal(-variable(b, h))
+                    };
+                    builder->addClause(clause.data(), clause.size());
+                }
+            }
+        }
+        builder->findSymmetries(SymmetryFinder::Automorphism::BLISS);
+
+        options.order = OCCURENCE;
+        builder->enableCosy(options);
+    }
+
+    static int variable(unsigned int pigeon, unsigned int hole) {
+        return pigeon * num_holes + hole + 1;
+    }
+
+    // ESBP given along a fixed sequence of random assignments
+    static std::vector<std::vector<Literal>>
+    search(SymmetryController<Literal> *controller) {
+        std::vector<std::vector<Literal>> clauses;
+        std::mt19937 random(42);
+
+        for (unsigned int round = 0; round < 200; round++) {
+            std::vector<Literal> trail;
+            for (unsigned int i = 0; i < num_vars / 2; i++) {
+                const int var = 1 + random() % num_vars;
+                const Literal literal(random() % 2 ? var : -var);
+                bool assigned = false;
+                for (const Literal& other : trail)
+                    assigned |= other.variable() == literal.variable();
+                if (assigned)
+                    continue;
+
+                trail.push_back(literal);
+                controller->updateNotify(literal);
+                if (controller->hasClauseToInject(ClauseInjector::ESBP,
+                                                  literal))
+                    clauses.push_back(controller->clauseToInject(
+                                          ClauseInjector::ESBP, literal));
+            }
+            while (!trail.empty()) {
+                controller->updateCancel(trail.back());
+                trail.pop_back();
+            }
+        }
+        return clauses;
+    }
+
+    std::unique_ptr<LiteralAdapter<Literal>> adapter;
+    std::unique_ptr<SymmetryController<Literal>> builder;
+    CosyOptions options;
+};
+
+TEST_F(SymmetryDataTest, sharedByControllers) {
+    const std::shared_ptr<const SymmetryData> data = builder->sharedData();
+    SymmetryController<Literal> controller(data, adapter);
+
+    controller.enableCosy(options);
+    ASSERT_EQ(&controller.group(), &builder->group());
+    ASSERT_GT(controller.group().numberOfPermutations(), 0);
+    ASSERT_NE(data->order(OCCURENCE, options.value), nullptr);
+    ASSERT_EQ(data->order(INCREASE, options.value), nullptr);
+
+    // The state of the search is not shared
+    const std::vector<std::vector<Literal>> expected = search(builder.get());
+    ASSERT_FALSE(expected.empty());
+    ASSERT_EQ(search(&controller), expected);
+}
+
+TEST_F(SymmetryDataTest, threadsGiveSameClauses) {
+    static const unsigned int num_threads = 8;
+    const std::shared_ptr<const SymmetryData> data = builder->sharedData();
+    const std::vector<std::vector<Literal>> expected = search(builder.get());
+    std::vector<std::vector<std::vector<Literal>>> results(num_threads);
+    std::vector<std::thread> threads;
+
+    for (unsigned int i = 0; i < num_threads; i++) {
+        threads.push_back(std::thread([&, i]() {
+            SymmetryController<Literal> controller(data, adapter);
+            controller.enableCosy(options);
+            results[i] = search(&controller);
+        }));
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    for (const std::vector<std::vector<Literal>>& result : results)
+        ASSERT_EQ(result, expected);
+}
+
+}  // namespace cosy
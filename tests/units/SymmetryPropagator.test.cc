@@ -0,0 +1,124 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "cosy/SymmetryPropagator.h"
+
+namespace cosy {
+
+class SymmetryPropagatorTest : public testing::Test {
+ protected:
+    static const unsigned int num_vars = 4;
+
+    virtual void SetUp() {
+        // Symmetric group on x1, x2, x3 generated by (1 2) and (2 3)
+        addTransposition(1, 2);
+        addTransposition(2, 3);
+        assignment.resize(num_vars);
+    }
+
+    void addTransposition(int a, int b) {
+        std::unique_ptr<Permutation> permutation(new Permutation(num_vars));
+        for (const int sign : { 1, -1 }) {
+            permutation->addToCurrentCycle(Literal(sign * a));
+            permutation->addToCurrentCycle(Literal(sign * b));
+            permutation->closeCurrentCycle();
+        }
+        group.addPermutation(std::move(permutation));
+    }
+
+    void assign(SymmetryPropagator *propagator, Literal literal,
+                bool is_decision) {
+        assignment.assignFromTrueLiteral(literal);
+        propagator->updateNotify(literal, is_decision);
+    }
+
+    void cancel(SymmetryPropagator *propagator, Literal literal) {
+        assignment.unassignLiteral(literal);
+        propagator->updateCancel(literal);
+    }
+
+    Group group;
+    Assignment assignment;
+};
+
+TEST_F(SymmetryPropagatorTest, weaklyActive) {
+    SymmetryPropagator propagator(group, assignment);
+
+    ASSERT_TRUE(propagator.isWeaklyActive(0));
+    ASSERT_TRUE(propagator.isWeaklyActive(1));
+
+    // (2 3) maps the decision x3 to x2 which is not assigned
+    assign(&propagator, Literal(3), true);
+    ASSERT_TRUE(propagator.isWeaklyActive(0));
+    ASSERT_FALSE(propagator.isWeaklyActive(1));
+
+    // (1 2) fixes x3, (2 3) maps it to the true x2
+    assign(&propagator, Literal(2), false);
+    ASSERT_TRUE(propagator.isWeaklyActive(0));
+    ASSERT_TRUE(propagator.isWeaklyActive(1));
+
+    cancel(&propagator, Literal(2));
+    ASSERT_TRUE(propagator.isWeaklyActive(0));
+    ASSERT_FALSE(propagator.isWeaklyActive(1));
+
+    cancel(&propagator, Literal(3));
+    ASSERT_TRUE(propagator.isWeaklyActive(0));
+    ASSERT_TRUE(propagator.isWeaklyActive(1));
+}
+
+TEST_F(SymmetryPropagatorTest, implicationAndReason) {
+    SymmetryPropagator propagator(group, assignment);
+
+    // x4 is a decision fixed by the group, x1 is propagated by (x1 v -x4)
+    assign(&propagator, Literal(4), true);
+    assign(&propagator, Literal(1), false);
+
+    ASSERT_TRUE(propagator.hasImplication());
+    const Literal implied = propagator.nextImplication();
+    ASSERT_EQ(implied, Literal(2));
+    ASSERT_FALSE(propagator.hasImplication());
+    ASSERT_EQ(propagator.source(implied), Literal(1));
+
+    const std::vector<Literal> reason =
+        propagator.reason(implied, { 1, -4 });
+    ASSERT_EQ(reason, std::vector<Literal>({ 2, -4 }));
+}
+
+TEST_F(SymmetryPropagatorTest, impliedAgainAfterDiscard) {
+    SymmetryPropagator propagator(group, assignment);
+
+    assign(&propagator, Literal(4), true);
+    assign(&propagator, Literal(1), false);
+    ASSERT_EQ(propagator.nextImplication(), Literal(2));
+    propagator.discard(Literal(2));
+
+    // (2 3) maps the propagated x3 to the unused implication x2
+    assign(&propagator, Literal(3), false);
+    ASSERT_TRUE(propagator.hasImplication());
+    ASSERT_EQ(propagator.nextImplication(), Literal(2));
+    ASSERT_EQ(propagator.source(Literal(2)), Literal(3));
+}
+
+TEST_F(SymmetryPropagatorTest, noImplicationWhenInactive) {
+    SymmetryPropagator propagator(group, assignment);
+
+    // The decision -x1 breaks (1 2), x3 is only moved by (2 3)
+    assign(&propagator, Literal(-1), true);
+    assign(&propagator, Literal(3), false);
+
+    ASSERT_FALSE(propagator.isWeaklyActive(0));
+    ASSERT_TRUE(propagator.hasImplication());
+    ASSERT_EQ(propagator.nextImplication(), Literal(2));
+
+    cancel(&propagator, Literal(3));
+    assign(&propagator, Literal(2), false);
+    // (1 2) is inactive and (2 3) would imply x3
+    ASSERT_EQ(propagator.nextImplication(), Literal(3));
+    ASSERT_FALSE(propagator.hasImplication());
+}
+
+}  // namespace cosy
@@ -0,0 +1,83 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "cosy/SymmetryReader.h"
+
+namespace cosy {
+
+class SymmetryReaderTest : public testing::Test {
+ protected:
+    static const unsigned int num_vars = 3;
+
+    virtual void SetUp() {
+        std::unique_ptr<SymmetryReader> reader
+            (SymmetryReader::create(SymmetryReader::SAUCY));
+        ASSERT_TRUE(reader->load("tests/resources/simple.cnf.sym", num_vars,
+                                 &expected));
+        ASSERT_EQ(expected.numberOfPermutations(), 2);
+    }
+
+    void load(SymmetryReader::Format format, const std::string& filename,
+              Group *group) {
+        std::unique_ptr<SymmetryReader> reader(SymmetryReader::create(format));
+        ASSERT_TRUE(reader->load(filename, num_vars, group));
+    }
+
+    void expectSameGroup(const Group& group) {
+        ASSERT_EQ(group.numberOfPermutations(),
+                  expected.numberOfPermutations());
+
+        for (unsigned int p = 0; p < group.permutations().size(); p++) {
+            const Permutation& a = *expected.permutations()[p];
+            const Permutation& b = *group.permutations()[p];
+            for (int v = 1; v <= static_cast<int>(num_vars); v++) {
+                for (const Literal literal : { Literal(v), Literal(-v) }) {
+                    ASSERT_EQ(a.isTrivialImage(literal),
+                              b.isTrivialImage(literal));
+                    if (!a.isTrivialImage(literal)) {
+                        ASSERT_EQ(a.imageOf(literal), b.imageOf(literal));
+                    }
+                }
+            }
+        }
+    }
+
+    Group expected;
+};
+
+TEST_F(SymmetryReaderTest, BreakID) {
+    Group group;
+    load(SymmetryReader::BREAKID, "tests/resources/simple.cnf.breakid",
+         &group);
+    expectSameGroup(group);
+}
+
+TEST_F(SymmetryReaderTest, Bliss) {
+    Group group;
+    load(SymmetryReader::BLISS, "tests/resources/simple.cnf.bliss", &group);
+    expectSameGroup(group);
+}
+
+TEST_F(SymmetryReaderTest, DreadnautContinuationLines) {
+    Group group;
+    load(SymmetryReader::DREADNAUT, "tests/resources/simple.cnf.dreadnaut",
+         &group);
+    expectSameGroup(group);
+}
+
+TEST_F(SymmetryReaderTest, TolerateMalformedGenerators) {
+    Group group;
+    load(SymmetryReader::BREAKID,
+         "tests/resources/simple_partial.cnf.breakid", &group);
+
+    // ( 1 3 ) and ( 1 -2 ) are completed with their negated cycles, the out
+    // of range and the inconsistent generators are dropped
+    ASSERT_EQ(group.numberOfPermutations(), 2);
+    expectSameGroup(group);
+}
+
+}  // namespace cosy
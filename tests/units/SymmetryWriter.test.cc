@@ -0,0 +1,89 @@
+// Copyright 2017 Hakan Metin - LIP6
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <memory>
+#include <string>
+
+#include "cosy/SymmetryReader.h"
+#include "cosy/SymmetryWriter.h"
+
+namespace cosy {
+
+class SymmetryWriterTest : public testing::Test {
+ protected:
+    virtual void SetUp() {
+        std::unique_ptr<SymmetryReader> reader
+            (SymmetryReader::create(SymmetryReader::SAUCY));
+        ASSERT_TRUE(reader->load("tests/resources/simple.cnf.sym", 3,
+                                 &simple));
+        filename = testing::TempDir() + "cosy_symmetry_writer";
+    }
+
+    virtual void TearDown() {
+        std::remove(filename.c_str());
+    }
+
+    void roundTrip(SymmetryWriter::Format writer_format,
+                   SymmetryReader::Format reader_format,
+                   unsigned int num_vars, const Group& group) {
+        std::unique_ptr<SymmetryWriter> writer
+            (SymmetryWriter::create(writer_format));
+        std::unique_ptr<SymmetryReader> reader
+            (SymmetryReader::create(reader_format));
+        Group loaded;
+
+        ASSERT_TRUE(writer->write(filename, num_vars, group));
+        ASSERT_TRUE(reader->load(filename, num_vars, &loaded));
+        ASSERT_EQ(loaded.numberOfPermutations(), group.numberOfPermutations());
+
+        for (unsigned int p = 0; p < group.permutations().size(); p++) {
+            const Permutation& expected = *group.permutations()[p];
+            const Permutation& actual = *loaded.permutations()[p];
+            ASSERT_EQ(expected.support(), actual.support());
+            for (const Literal& element : expected.support())
+                ASSERT_EQ(expected.imageOf(element), actual.imageOf(element));
+        }
+    }
+
+    Group simple;
+    std::string filename;
+};
+
+TEST_F(SymmetryWriterTest, Saucy) {
+    roundTrip(SymmetryWriter::SAUCY, SymmetryReader::SAUCY, 3, simple);
+}
+
+TEST_F(SymmetryWriterTest, BreakID) {
+    roundTrip(SymmetryWriter::BREAKID, SymmetryReader::BREAKID, 3, simple);
+}
+
+TEST_F(SymmetryWriterTest, Binary) {
+    roundTrip(SymmetryWriter::BINARY, SymmetryReader::BINARY, 3, simple);
+}
+
+TEST_F(SymmetryWriterTest, LargeGroup) {
+    const unsigned int num_vars = 5000;
+    Group group;
+
+    // Shifts of variables by block, in both polarities
+    for (int p = 1; p <= 5; p++) {
+        std::unique_ptr<Permutation> permutation(new Permutation(num_vars));
+        for (int start = 1; start + p <= static_cast<int>(num_vars);
+             start += p + 1) {
+            for (const int sign : { 1, -1 }) {
+                for (int v = start; v <= start + p; v++)
+                    permutation->addToCurrentCycle(Literal(sign * v));
+                permutation->closeCurrentCycle();
+            }
+        }
+        group.addPermutation(std::move(permutation));
+    }
+
+    roundTrip(SymmetryWriter::SAUCY, SymmetryReader::SAUCY, num_vars, group);
+    roundTrip(SymmetryWriter::BINARY, SymmetryReader::BINARY, num_vars,
+              group);
+}
+
+}  // namespace cosy